@@ -0,0 +1,35 @@
+/** Allocations Namespace - Header
+ *
+ *	@file 		Allocation Counter
+ *
+ *	@brief 		Allocations Namespace - Replaces the global operator new/delete of the executable it is linked
+ *				into with versions that count heap allocations, shared by RVTests and the benchmark executables
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_ALLOCATIONS_H
+#define RV_ALLOCATIONS_H
+
+#include <cstddef>
+
+namespace Allocations {
+	// *------------------------------*
+	// |     	   COUNTERS           |
+	// *------------------------------*
+
+	/** @brief		Number of calls to operator new and bytes requested since program start (all threads)
+	 *
+	 *	@remark		The replacement operators live in Allocations.cpp, so that file must be compiled into the
+	 *				executable; keeping them out of line also keeps the compiler from pairing an inlined
+	 *				new with an inlined free() when it checks for mismatched deallocation
+	 */
+	std::size_t count();
+	std::size_t bytes();
+}
+#endif //RV_ALLOCATIONS_H
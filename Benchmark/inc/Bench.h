@@ -0,0 +1,183 @@
+/** Bench Namespace - Header
+ *
+ *	@file 		Benchmark Harness
+ *
+ *	@brief 		Bench Namespace - Minimal harness used by the benchmark executables. Times a callable
+ *				until a minimum duration is reached, counts heap allocations through a global
+ *				operator new hook, reports the results as JSON and compares them against a baseline report
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_BENCH_H
+#define RV_BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Allocations.h"
+
+namespace Bench {
+	// *------------------------------*
+	// |     	 ALLOCATIONS          |
+	// *------------------------------*
+
+	/** @brief		Peak resident set size of the process so far in kilobytes (0 where unsupported) */
+	std::size_t peakRss();
+
+	// *------------------------------*
+	// |     	   RESULTS            |
+	// *------------------------------*
+
+	/** @brief		Measurement of one benchmark case
+	 *
+	 *	@details	An iteration is one call of the benchmarked function and processes size elements,
+	 *				so nsPerOp and opsPerSecond are per element. The case is measured repeats times with
+	 *				the same number of iterations; nsPerOp is the mean over the repeats and nsPerOpCi the
+	 *				half-width of its 95% confidence interval
+	 */
+	struct Result {
+		std::string name;
+		std::size_t size;
+		std::uint64_t iterations;
+		std::size_t repeats;
+		double seconds;
+		double nsPerOp;
+		double nsPerOpCi;
+		double nsPerOpMin;
+		double opsPerSecond;
+		double allocationsPerIteration;
+		double bytesPerIteration;
+	};
+
+	/** @brief		Command line options shared by the benchmark executables
+	 *
+	 *	@details	--min-time <seconds>	Minimum measured time of each case (default 0.2)
+	 *				--repeats <n>			Number of measurements of each case (default 1)
+	 *				--filter <text>			Only run cases whose name contains text
+	 *				--out <path>			Write the JSON report to path instead of stdout
+	 *				--baseline <path>		Compare against a stored report and fail on regressions
+	 *				--threshold <fraction>	Tolerated slowdown against the baseline (default 0.1)
+	 */
+	struct Options {
+		double minTime = 0.2;
+		unsigned int repeats = 1;
+		std::string filter;
+		std::string output;
+		std::string baseline;
+		double threshold = 0.1;
+	};
+
+	/** @throws		std::invalid_argument exception on an unknown or incomplete option */
+	Options parseOptions(const int argc, const char* const* argv);
+
+	/** @brief		Writes a string as a quoted JSON string, or a number with 6 significant digits */
+	void writeString(std::ostream& os, const std::string& s);
+	void writeNumber(std::ostream& os, const double d);
+
+	/** @brief		Writes results as a JSON report {"suite": ..., "results": [...]} */
+	void writeJson(std::ostream& os, const std::string& suite, const std::vector<Result>& results);
+
+	/** @brief		Reads the results of a JSON report written by writeJson()
+	 *
+	 *	@throws		std::invalid_argument exception if the report is malformed
+	 */
+	std::vector<Result> readJson(std::istream& is);
+
+	/** @brief		Half-width of the 95% confidence interval of the mean of a sample (Student's t) */
+	double confidence(const std::vector<double>& samples);
+
+	/** @brief		Compares results against baseline results of the same name and size
+	 *
+	 *	@details	A case regresses when its mean time exceeds the baseline by more than threshold and
+	 *				the confidence intervals of both means do not overlap, or when it allocates more
+	 *				per iteration than the baseline. Cases missing from either side are reported only
+	 *	@param	os			Stream receiving a line per compared case
+	 *	@returns	Number of regressed cases
+	 */
+	std::size_t compare(std::ostream& os, const std::vector<Result>& baseline, const std::vector<Result>& results,
+		const double threshold);
+
+	// *------------------------------*
+	// |     	    SUITE             |
+	// *------------------------------*
+
+	/** @brief		Collection of timed cases reported together
+	 *
+	 *	@example	Bench::Suite suite("RVBench", Bench::parseOptions(argc, argv));
+	 *				suite.run("Normal::cdf", n, [&]{ return n.cdf(1); });
+	 *				return suite.report();
+	 */
+	class Suite {
+	public:
+		Suite(const std::string& name, const Options& options);
+
+		/** @brief		Times f, doubling the iteration count until the batch takes at least minTime
+		 *
+		 *	@param	name	Case name (skipped when it does not match the filter)
+		 *	@param	size	Number of elements processed by one call of f
+		 *	@param	f		Function returning a double, which is kept so the call is not optimized out
+		 */
+		template<typename F>
+		void run(const std::string& name, const std::size_t size, F f) {
+			if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+				return;
+			}
+			sink += f();	// warm up caches and lazily initialized state
+			std::uint64_t iterations = 1;
+			std::vector<double> seconds;
+			std::size_t allocs = 0;
+			std::size_t bytes = 0;
+			// The first batch reaching minTime fixes the iteration count and is the first repeat
+			while (seconds.size() < options.repeats) {
+				const std::size_t allocsBefore = Allocations::count();
+				const std::size_t bytesBefore = Allocations::bytes();
+				const auto start = std::chrono::steady_clock::now();
+				for (std::uint64_t i = 0; i < iterations; i++) {
+					sink += f();
+				}
+				const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				const std::size_t allocsAfter = Allocations::count();
+				const std::size_t bytesAfter = Allocations::bytes();
+				if (seconds.empty() && s < options.minTime && iterations < (std::uint64_t(1) << 40)) {
+					iterations *= 2;
+					continue;
+				}
+				seconds.push_back(s);
+				allocs += allocsAfter - allocsBefore;
+				bytes += bytesAfter - bytesBefore;
+			}
+			record(name, size, iterations, seconds, allocs, bytes);
+		}
+
+		/** @brief		Writes the JSON report to the output file or stdout, then compares it to the baseline
+		 *
+		 *	@returns	Process exit code (0 on success, 1 on an I/O error or a regression)
+		 */
+		int report() const;
+
+		inline const std::vector<Result>& getResults() const {
+			return results;
+		}
+
+	private:
+		void record(const std::string& name, const std::size_t size, const std::uint64_t iterations,
+			const std::vector<double>& seconds, const std::size_t allocs, const std::size_t bytes);
+
+		std::string suite;
+		Options options;
+		std::vector<Result> results;
+		volatile double sink;
+	};
+}
+#endif //RV_BENCH_H
@@ -0,0 +1,83 @@
+/** Allocations Namespace - Implementation
+ *
+ *	@file 		Allocation Counter
+ *
+ *	@brief 		Allocations Namespace - Replaces the global operator new/delete of the executable it is linked
+ *				into with versions that count heap allocations, shared by RVTests and the benchmark executables
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "Allocations.h"
+
+namespace {
+	std::atomic<std::size_t> allocationCount(0);
+	std::atomic<std::size_t> allocationBytes(0);
+
+	void* countedAllocate(const std::size_t n) {
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+		allocationBytes.fetch_add(n, std::memory_order_relaxed);
+		return std::malloc(n > 0 ? n : 1);
+	}
+}
+
+// *------------------------------*
+// |     	 REPLACEMENTS         |
+// *------------------------------*
+
+void* operator new(std::size_t n) {
+	void* p = countedAllocate(n);
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new[](std::size_t n) {
+	return operator new(n);
+}
+
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept {
+	return countedAllocate(n);
+}
+
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept {
+	return countedAllocate(n);
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+	std::free(p);
+}
+
+// *------------------------------*
+// |     	   COUNTERS           |
+// *------------------------------*
+
+std::size_t Allocations::count() {
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::size_t Allocations::bytes() {
+	return allocationBytes.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,362 @@
+/** Bench Namespace - Implementation
+ *
+ *	@file 		Benchmark Harness
+ *
+ *	@brief 		Bench Namespace - Minimal harness used by the benchmark executables. Times a callable
+ *				until a minimum duration is reached, counts heap allocations with the Allocations hook,
+ *				reports the results as JSON and compares them against a baseline report
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "Bench.h"
+
+// *------------------------------*
+// |     	 ALLOCATIONS          |
+// *------------------------------*
+
+std::size_t Bench::peakRss() {
+#if defined(__unix__) || defined(__APPLE__)
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+#ifdef __APPLE__
+	// ru_maxrss is in bytes on macOS and in kilobytes on Linux
+	return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#else
+	return static_cast<std::size_t>(usage.ru_maxrss);
+#endif
+#else
+	return 0;
+#endif
+}
+
+// *------------------------------*
+// |     	   RESULTS            |
+// *------------------------------*
+
+Bench::Options Bench::parseOptions(const int argc, const char* const* argv) {
+	Options options;
+	for (int i = 1; i < argc; i++) {
+		const std::string arg = argv[i];
+		if (i + 1 >= argc) {
+			throw std::invalid_argument("Missing value for benchmark option " + arg);
+		}
+		if (arg == "--min-time") {
+			options.minTime = std::atof(argv[++i]);
+		} else if (arg == "--repeats") {
+			const int repeats = std::atoi(argv[++i]);
+			if (repeats < 1) {
+				throw std::invalid_argument("Benchmark option --repeats must be at least 1");
+			}
+			options.repeats = static_cast<unsigned int>(repeats);
+		} else if (arg == "--filter") {
+			options.filter = argv[++i];
+		} else if (arg == "--out") {
+			options.output = argv[++i];
+		} else if (arg == "--baseline") {
+			options.baseline = argv[++i];
+		} else if (arg == "--threshold") {
+			options.threshold = std::atof(argv[++i]);
+		} else {
+			throw std::invalid_argument("Unknown benchmark option " + arg);
+		}
+	}
+	return options;
+}
+
+void Bench::writeString(std::ostream& os, const std::string& s) {
+	os << '"';
+	for (const char c : s) {
+		if (c == '"' || c == '\\') {
+			os << '\\';
+		}
+		os << c;
+	}
+	os << '"';
+}
+
+void Bench::writeNumber(std::ostream& os, const double d) {
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "%.6g", d);
+	os << buffer;
+}
+
+void Bench::writeJson(std::ostream& os, const std::string& suite, const std::vector<Result>& results) {
+	os << "{\n  \"suite\": ";
+	writeString(os, suite);
+	os << ",\n  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n  \"results\": [";
+	for (std::size_t i = 0; i < results.size(); i++) {
+		const Result& r = results[i];
+		os << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+		writeString(os, r.name);
+		os << ", \"size\": " << r.size << ", \"iterations\": " << r.iterations << ", \"repeats\": " << r.repeats;
+		os << ", \"seconds\": ";
+		writeNumber(os, r.seconds);
+		os << ", \"ns_per_op\": ";
+		writeNumber(os, r.nsPerOp);
+		os << ", \"ns_per_op_ci\": ";
+		writeNumber(os, r.nsPerOpCi);
+		os << ", \"ns_per_op_min\": ";
+		writeNumber(os, r.nsPerOpMin);
+		os << ", \"ops_per_second\": ";
+		writeNumber(os, r.opsPerSecond);
+		os << ", \"allocations_per_iteration\": ";
+		writeNumber(os, r.allocationsPerIteration);
+		os << ", \"bytes_per_iteration\": ";
+		writeNumber(os, r.bytesPerIteration);
+		os << "}";
+	}
+	os << "\n  ]\n}\n";
+}
+
+namespace {
+	void skipSpace(const std::string& text, std::size_t& pos) {
+		while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+			pos++;
+		}
+	}
+
+	void expect(const std::string& text, std::size_t& pos, const char c) {
+		skipSpace(text, pos);
+		if (pos >= text.size() || text[pos] != c) {
+			throw std::invalid_argument(std::string("Malformed benchmark report, expected '") + c + "'");
+		}
+		pos++;
+	}
+
+	std::string readString(const std::string& text, std::size_t& pos) {
+		expect(text, pos, '"');
+		std::string s;
+		for (; pos < text.size() && text[pos] != '"'; pos++) {
+			if (text[pos] == '\\') {
+				pos++;
+			}
+			if (pos < text.size()) {
+				s += text[pos];
+			}
+		}
+		expect(text, pos, '"');
+		return s;
+	}
+
+	double readNumber(const std::string& text, std::size_t& pos) {
+		skipSpace(text, pos);
+		const char* begin = text.c_str() + pos;
+		char* end = nullptr;
+		const double d = std::strtod(begin, &end);
+		if (end == begin) {
+			throw std::invalid_argument("Malformed benchmark report, expected a number");
+		}
+		pos += static_cast<std::size_t>(end - begin);
+		return d;
+	}
+
+	/** @brief	Reads one {"key": value, ...} result object; unknown keys are ignored */
+	Bench::Result readResult(const std::string& text, std::size_t& pos) {
+		Bench::Result r = Bench::Result();
+		expect(text, pos, '{');
+		skipSpace(text, pos);
+		while (pos < text.size() && text[pos] != '}') {
+			const std::string key = readString(text, pos);
+			expect(text, pos, ':');
+			skipSpace(text, pos);
+			if (pos < text.size() && text[pos] == '"') {
+				const std::string value = readString(text, pos);
+				if (key == "name") {
+					r.name = value;
+				}
+			} else {
+				const double value = readNumber(text, pos);
+				if (key == "size") {
+					r.size = static_cast<std::size_t>(value);
+				} else if (key == "iterations") {
+					r.iterations = static_cast<std::uint64_t>(value);
+				} else if (key == "repeats") {
+					r.repeats = static_cast<std::size_t>(value);
+				} else if (key == "seconds") {
+					r.seconds = value;
+				} else if (key == "ns_per_op") {
+					r.nsPerOp = value;
+				} else if (key == "ns_per_op_ci") {
+					r.nsPerOpCi = value;
+				} else if (key == "ns_per_op_min") {
+					r.nsPerOpMin = value;
+				} else if (key == "ops_per_second") {
+					r.opsPerSecond = value;
+				} else if (key == "allocations_per_iteration") {
+					r.allocationsPerIteration = value;
+				} else if (key == "bytes_per_iteration") {
+					r.bytesPerIteration = value;
+				}
+			}
+			skipSpace(text, pos);
+			if (pos < text.size() && text[pos] == ',') {
+				pos++;
+				skipSpace(text, pos);
+			}
+		}
+		expect(text, pos, '}');
+		return r;
+	}
+}
+
+std::vector<Bench::Result> Bench::readJson(std::istream& is) {
+	const std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+	std::size_t pos = text.find("\"results\"");
+	if (pos == std::string::npos) {
+		throw std::invalid_argument("Benchmark report has no results");
+	}
+	pos += 9;
+	expect(text, pos, ':');
+	expect(text, pos, '[');
+	std::vector<Result> results;
+	skipSpace(text, pos);
+	while (pos < text.size() && text[pos] != ']') {
+		results.push_back(readResult(text, pos));
+		skipSpace(text, pos);
+		if (pos < text.size() && text[pos] == ',') {
+			pos++;
+			skipSpace(text, pos);
+		}
+	}
+	expect(text, pos, ']');
+	return results;
+}
+
+double Bench::confidence(const std::vector<double>& samples) {
+	// Two-sided 95% quantiles of Student's t distribution for 1 to 30 degrees of freedom
+	static const double T95[] = { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+		2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+		2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+	const std::size_t n = samples.size();
+	if (n < 2) {
+		return 0;
+	}
+	double mean = 0;
+	for (const double x : samples) {
+		mean += x;
+	}
+	mean /= static_cast<double>(n);
+	double ss = 0;
+	for (const double x : samples) {
+		ss += (x - mean) * (x - mean);
+	}
+	const double t = n - 1 <= 30 ? T95[n - 2] : 1.96;
+	return t * std::sqrt(ss / static_cast<double>(n - 1) / static_cast<double>(n));
+}
+
+std::size_t Bench::compare(std::ostream& os, const std::vector<Result>& baseline, const std::vector<Result>& results,
+	const double threshold) {
+	std::size_t regressions = 0;
+	for (const Result& r : results) {
+		const Result* base = nullptr;
+		for (const Result& b : baseline) {
+			if (b.name == r.name && b.size == r.size) {
+				base = &b;
+				break;
+			}
+		}
+		os << r.name << " [" << r.size << "]: ";
+		if (base == nullptr) {
+			os << "not in baseline" << std::endl;
+			continue;
+		}
+		const double change = r.nsPerOp / base->nsPerOp - 1;
+		const bool slower = change > threshold && r.nsPerOp - r.nsPerOpCi > base->nsPerOp + base->nsPerOpCi;
+		// Allocation counts are deterministic, half an allocation per iteration absorbs rounding
+		const bool allocates = r.allocationsPerIteration > base->allocationsPerIteration + 0.5;
+		os << base->nsPerOp << " -> " << r.nsPerOp << " ns/op (" << (change >= 0 ? "+" : "") << change * 100 << "%)";
+		if (slower) {
+			os << " REGRESSED";
+		}
+		if (allocates) {
+			os << " ALLOCATIONS " << base->allocationsPerIteration << " -> " << r.allocationsPerIteration;
+		}
+		os << std::endl;
+		if (slower || allocates) {
+			regressions++;
+		}
+	}
+	return regressions;
+}
+
+// *------------------------------*
+// |     	    SUITE             |
+// *------------------------------*
+
+Bench::Suite::Suite(const std::string& name, const Options& o) : suite(name), options(o), results(), sink(0) {}
+
+void Bench::Suite::record(const std::string& name, const std::size_t size, const std::uint64_t iterations,
+	const std::vector<double>& seconds, const std::size_t allocs, const std::size_t bytes) {
+	const double ops = static_cast<double>(iterations) * static_cast<double>(size > 0 ? size : 1);
+	std::vector<double> ns(seconds.size());
+	for (std::size_t i = 0; i < seconds.size(); i++) {
+		ns[i] = seconds[i] * 1e9 / ops;
+	}
+	const double runs = static_cast<double>(iterations) * static_cast<double>(seconds.size());
+	Result r;
+	r.name = name;
+	r.size = size;
+	r.iterations = iterations;
+	r.repeats = seconds.size();
+	r.seconds = 0;
+	r.nsPerOp = 0;
+	for (std::size_t i = 0; i < seconds.size(); i++) {
+		r.seconds += seconds[i];
+		r.nsPerOp += ns[i] / static_cast<double>(ns.size());
+	}
+	r.nsPerOpCi = confidence(ns);
+	r.nsPerOpMin = *std::min_element(ns.cbegin(), ns.cend());
+	r.opsPerSecond = 1e9 / r.nsPerOp;
+	r.allocationsPerIteration = static_cast<double>(allocs) / runs;
+	r.bytesPerIteration = static_cast<double>(bytes) / runs;
+	results.push_back(r);
+	std::cerr << name << " [" << size << "]: " << r.nsPerOp << " +- " << r.nsPerOpCi << " ns/op, "
+		<< r.allocationsPerIteration << " allocs/iter" << std::endl;
+}
+
+int Bench::Suite::report() const {
+	if (options.output.empty()) {
+		writeJson(std::cout, suite, results);
+	} else {
+		std::ofstream os(options.output);
+		writeJson(os, suite, results);
+		if (!os) {
+			std::cerr << "Could not write " << options.output << std::endl;
+			return 1;
+		}
+	}
+	if (options.baseline.empty()) {
+		return 0;
+	}
+	std::ifstream is(options.baseline);
+	if (!is) {
+		std::cerr << "Could not open baseline " << options.baseline << std::endl;
+		return 1;
+	}
+	const std::size_t regressions = compare(std::cerr, readJson(is), results, options.threshold);
+	std::cerr << regressions << " regression(s) against " << options.baseline << std::endl;
+	return regressions == 0 ? 0 : 1;
+}
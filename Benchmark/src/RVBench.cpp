@@ -0,0 +1,201 @@
+/** RVBench - Micro-benchmarks
+ *
+ *	@file 		Micro-benchmark Suite
+ *
+ *	@brief 		Times the hot paths of the library (parametric sampling and pdf/cdf/icdf, the normal quantile,
+ *				Weighted and Unweighted data sets, Translation, concurrent ingest) at several sizes and prints a JSON report
+ *
+ *	@example	RVBench --min-time 0.5 --filter Normal --out bench.json
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Ingest.h"
+#include "Normal.h"
+#include "Lognormal.h"
+#include "Unweighted.h"
+#include "Weighted.h"
+#include "Translation.h"
+
+namespace {
+	const std::size_t SIZES[] = { 1000, 100000 };
+	// Weighted lookups are linear in the number of distinct values
+	const std::size_t WEIGHTED_SIZES[] = { 100, 10000 };
+
+	/** @brief	Name of a case timed per call (size 1) on a data set of n values, e.g. "Weighted::median(n=100)" */
+	std::string perCall(const std::string& name, const std::size_t n) {
+		return name + "(n=" + std::to_string(n) + ")";
+	}
+
+	/** @brief	Evenly spaced values in (lo, hi), used as pdf/cdf inputs and as data sets */
+	std::vector<double> linspace(const std::size_t n, const double lo, const double hi) {
+		std::vector<double> v(n);
+		for (std::size_t i = 0; i < n; i++) {
+			v[i] = lo + (hi - lo) * (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+		}
+		return v;
+	}
+
+	/** @brief	Sampling and pdf/cdf/icdf of a parametric distribution over n inputs */
+	template<typename D>
+	void parametric(Bench::Suite& suite, const std::string& name, const D& d, const double lo, const double hi) {
+		for (const std::size_t n : SIZES) {
+			const std::vector<double> x = linspace(n, lo, hi);
+			const std::vector<double> y = linspace(n, 0, 1);
+			std::vector<double> out(n);
+			suite.run(name + "::sample", n, [&]{ d.sample(static_cast<unsigned int>(n), out.data()); return out[0]; });
+			suite.run(name + "::sample(vector)", n, [&]{ return d.sample(static_cast<unsigned int>(n))[0]; });
+			suite.run(name + "::pdf", n, [&]{
+				double s = 0;
+				for (const double v : x) {
+					s += d.pdf(v);
+				}
+				return s;
+			});
+			suite.run(name + "::cdf", n, [&]{
+				double s = 0;
+				for (const double v : x) {
+					s += d.cdf(v);
+				}
+				return s;
+			});
+			suite.run(name + "::sampleIcdf", n, [&]{ d.sampleIcdf(static_cast<unsigned int>(n), y.data(), out.data()); return out[0]; });
+			suite.run(name + "::icdf", n, [&]{
+				double s = 0;
+				for (const double v : y) {
+					s += d.icdf(v);
+				}
+				return s;
+			});
+		}
+	}
+
+	void normInv(Bench::Suite& suite) {
+		const Normal normal(0, 1);
+		for (const std::size_t n : SIZES) {
+			const std::vector<double> y = linspace(n, 0, 1);
+			suite.run("Normal::calcNormInv", n, [&]{
+				double s = 0;
+				for (const double v : y) {
+					s += normal.calcNormInv(v);
+				}
+				return s;
+			});
+		}
+	}
+
+	void weighted(Bench::Suite& suite) {
+		for (const std::size_t n : WEIGHTED_SIZES) {
+			const std::vector<double> values = linspace(n, 0, 100);
+			// Every value twice, so construction also merges duplicates
+			std::vector<double> doubled(values);
+			doubled.insert(doubled.end(), values.cbegin(), values.cend());
+			const Weighted distinct(values);
+			Weighted w(values);
+			const double middle = values[n / 2];
+			suite.run("Weighted::Weighted(vector)", n, [&]{ return Weighted(doubled).mean(); });
+			suite.run(perCall("Weighted::append", n), 1, [&]{ w.append(middle); return middle; });
+			suite.run("Weighted::get", n, [&]{
+				double s = 0;
+				for (std::size_t k = 0; k < n; k++) {
+					s += w.get(k);
+				}
+				return s;
+			});
+			suite.run(perCall("Weighted::median", n), 1, [&]{ return distinct.median(); });
+		}
+		// Continuous data: binning keeps the number of pairs, and so every later scan, bounded
+		for (const std::size_t n : SIZES) {
+			const Normal normal(5, 2);
+			const std::vector<double> values = normal.sample(static_cast<unsigned int>(n));
+			const Weighted binned(values, Binning::absolute(0.01));
+			suite.run("Weighted::Weighted(vector, absolute)", n, [&]{ return Weighted(values, Binning::absolute(0.01)).mean(); });
+			suite.run(perCall("Weighted::mean(absolute)", n), 1, [&]{ return binned.mean(); });
+		}
+	}
+
+	void unweighted(Bench::Suite& suite) {
+		for (const std::size_t n : SIZES) {
+			const Normal normal(5, 2);
+			const Unweighted uw(normal.sample(static_cast<unsigned int>(n)));
+			suite.run("Unweighted::mean", n, [&]{ return uw.mean(); });
+			suite.run("Unweighted::std", n, [&]{ return uw.std(); });
+			suite.run(perCall("Unweighted::median", n), 1, [&]{ return uw.median(); });
+			Unweighted tracked(uw);
+			tracked.setMedianTracking(true);
+			suite.run(perCall("Unweighted::median(tracked)", n), 1, [&]{ return tracked.median(); });
+			suite.run(perCall("Unweighted::append(tracked)", n), 1, [&]{ tracked.append(5); return tracked.median(); });
+			suite.run("Unweighted::mode", n, [&]{ return uw.mode(); });
+			Unweighted scaled(uw);
+			std::vector<std::size_t> indices(n);
+			for (std::size_t i = 0; i < n; i++) {
+				indices[i] = (i * 7919) % n;
+			}
+			std::vector<double> out(n);
+			suite.run("Unweighted::transform", n, [&]{ scaled.transform([](const double x){ return x * 0.5 + 1; }, 1); return scaled.get(0); });
+			suite.run("Unweighted::gather", n, [&]{ uw.gather(n, indices.data(), out.data()); return out[0]; });
+		}
+	}
+
+	void ingest(Bench::Suite& suite) {
+		for (const std::size_t n : SIZES) {
+			suite.run("Ingest::append", n, [&]{
+				Unweighted uw(RandomVariable::vector_type{});
+				Ingest in(uw);
+				{
+					Ingest::Producer p = in.producer();
+					for (std::size_t i = 0; i < n; i++) {
+						p.append(static_cast<double>(i));
+					}
+				}
+				return static_cast<double>(in.flush());
+			});
+		}
+	}
+
+	void translation(Bench::Suite& suite) {
+		const Normal normal(5, 2);
+		for (const std::size_t n : SIZES) {
+			const unsigned int count = static_cast<unsigned int>(n);
+			const Unweighted uw(normal.sample(count));
+			const Unweighted positive(Lognormal(0, 0.5).sample(count));
+			suite.run("Translation::sample<Unweighted>", n, [&]{ return Translation::sample<Unweighted>(&normal, count).get(0); });
+			suite.run("Translation::sample<Weighted>", n, [&]{ return Translation::sample<Weighted>(&normal, count).mean(); });
+			suite.run("Translation::fit<Normal>", n, [&]{ return Translation::fit<Normal>(&uw).mean(); });
+			suite.run("Translation::fitMLE<Normal>", n, [&]{ return Translation::fitMLE<Normal>(&uw).mean(); });
+			suite.run("Translation::fitMLE<Lognormal>", n, [&]{ return Translation::fitMLE<Lognormal>(&positive).mean(); });
+			const Normal fn = Translation::fitMLE<Normal>(&positive);
+			const Lognormal fl = Translation::fitMLE<Lognormal>(&positive);
+			suite.run("Translation::compare", n, [&]{ return Translation::compare(&positive, { &fn, &fl })[0].aic; });
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	try {
+		Bench::Suite suite("RVBench", Bench::parseOptions(argc, argv));
+		parametric(suite, "Normal", Normal(5, 2), -1, 11);
+		parametric(suite, "Lognormal", Lognormal(0, 0.5), 0.05, 5);
+		normInv(suite);
+		weighted(suite);
+		unweighted(suite);
+		translation(suite);
+		ingest(suite);
+		return suite.report();
+	} catch (const std::exception& e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,239 @@
+/** RVScaling - Scaling benchmark
+ *
+ *	@file 		Monte Carlo Propagation Scaling Benchmark
+ *
+ *	@brief 		Reproduces an end-to-end uncertainty propagation: Normal, Lognormal and empirical inputs are
+ *				sampled in parallel, pushed through a user model, collected into a Weighted set and summarised.
+ *				Sweeps thread counts and problem sizes and prints throughput, parallel efficiency and peak
+ *				RSS as JSON
+ *
+ *	@details	--threads <list>	Thread counts, e.g. 1,2,4,8 (default powers of two up to the hardware concurrency)
+ *				--sizes <list>		Number of samples, e.g. 1e6,1e7 (default 1e6,1e7); per thread with --weak
+ *				--weak				Weak scaling: the problem size grows with the number of threads
+ *				--out <path>		Write the JSON report to path instead of stdout
+ *
+ *	@remark		Efficiency is relative to the first thread count of the sweep at the same size (strong
+ *				scaling) or the same size per thread (weak scaling). Peak RSS is the process high-water
+ *				mark, so sizes are run in increasing order
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Bench.h"
+#include "Lognormal.h"
+#include "Normal.h"
+#include "Parallel.h"
+#include "Unweighted.h"
+#include "Weighted.h"
+
+namespace {
+	// Samples drawn from each input per call, so the sampling buffers stay in cache
+	const unsigned int BLOCK = 4096;
+
+	struct Options {
+		std::vector<unsigned int> threads;
+		std::vector<std::size_t> sizes;
+		bool weak = false;
+		std::string output;
+	};
+
+	struct Run {
+		std::size_t size;
+		unsigned int threads;
+		double propagateSeconds;
+		double collectSeconds;
+		double summariseSeconds;
+		double efficiency;
+		double propagateEfficiency;
+		std::size_t peakRss;
+		double mean;
+		double std;
+	};
+
+	/** @brief	Splits a comma separated list, e.g. "1e6,1e7" */
+	std::vector<double> parseList(const std::string& s) {
+		std::vector<double> values;
+		std::stringstream ss(s);
+		std::string item;
+		while (std::getline(ss, item, ',')) {
+			char* end = nullptr;
+			const double d = std::strtod(item.c_str(), &end);
+			if (item.empty() || *end != '\0' || d < 1) {
+				throw std::invalid_argument("Invalid list entry \"" + item + "\"");
+			}
+			values.push_back(d);
+		}
+		return values;
+	}
+
+	Options parseOptions(const int argc, const char* const* argv) {
+		Options options;
+		for (int i = 1; i < argc; i++) {
+			const std::string arg = argv[i];
+			if (arg == "--weak") {
+				options.weak = true;
+				continue;
+			}
+			if (i + 1 >= argc) {
+				throw std::invalid_argument("Missing value for option " + arg);
+			}
+			if (arg == "--threads") {
+				for (const double d : parseList(argv[++i])) {
+					options.threads.push_back(static_cast<unsigned int>(d));
+				}
+			} else if (arg == "--sizes") {
+				for (const double d : parseList(argv[++i])) {
+					options.sizes.push_back(static_cast<std::size_t>(d));
+				}
+			} else if (arg == "--out") {
+				options.output = argv[++i];
+			} else {
+				throw std::invalid_argument("Unknown option " + arg);
+			}
+		}
+		if (options.threads.empty()) {
+			const unsigned int hw = Parallel::threads(0);
+			for (unsigned int t = 1; t < hw; t *= 2) {
+				options.threads.push_back(t);
+			}
+			options.threads.push_back(hw);
+		}
+		if (options.sizes.empty()) {
+			options.sizes = { 1000000, 10000000 };
+		}
+		std::sort(options.sizes.begin(), options.sizes.end());
+		return options;
+	}
+
+	/** @brief	User model combining one draw of each input (remaining capacity of a component) */
+	inline double model(const double load, const double wear, const double ambient) {
+		return 100 - load * wear - 0.1 * ambient;
+	}
+
+	double elapsed(const std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	/** @brief	Propagates n samples through the model on nThreads threads, then collects and summarises them */
+	Run propagate(const std::size_t n, const unsigned int nThreads, const Normal& load, const Lognormal& wear, const Unweighted& ambient) {
+		Run run = Run();
+		run.size = n;
+		run.threads = nThreads;
+		std::vector<double> outputs(n);
+
+		auto start = std::chrono::steady_clock::now();
+		Parallel::forChunks(n, nThreads, [&](const unsigned int chunk, const std::size_t begin, const std::size_t end) {
+			std::mt19937_64 gen(chunk);
+			std::uniform_int_distribution<std::size_t> pick(0, ambient.getSize() - 1);
+			std::vector<double> a(BLOCK);
+			std::vector<double> b(BLOCK);
+			for (std::size_t i = begin; i < end; i += BLOCK) {
+				const unsigned int m = static_cast<unsigned int>(std::min<std::size_t>(BLOCK, end - i));
+				load.sample(m, a.data());
+				wear.sample(m, b.data());
+				// The empirical input is resampled with replacement
+				for (unsigned int j = 0; j < m; j++) {
+					outputs[i + j] = model(a[j], b[j], ambient.get(pick(gen)));
+				}
+			}
+		});
+		run.propagateSeconds = elapsed(start);
+
+		start = std::chrono::steady_clock::now();
+		const Weighted collected(std::move(outputs));
+		run.collectSeconds = elapsed(start);
+
+		start = std::chrono::steady_clock::now();
+		run.mean = collected.mean();
+		run.std = collected.std();
+		run.summariseSeconds = elapsed(start);
+
+		run.peakRss = Bench::peakRss();
+		return run;
+	}
+
+	void writeJson(std::ostream& os, const Options& options, const std::vector<Run>& runs) {
+		os << "{\n  \"suite\": \"RVScaling\",\n  \"hardware_threads\": " << std::thread::hardware_concurrency();
+		os << ",\n  \"scaling\": \"" << (options.weak ? "weak" : "strong") << "\",\n  \"results\": [";
+		for (std::size_t i = 0; i < runs.size(); i++) {
+			const Run& r = runs[i];
+			const double seconds = r.propagateSeconds + r.collectSeconds + r.summariseSeconds;
+			const std::pair<const char*, double> fields[] = {
+				{ "seconds", seconds },
+				{ "propagate_seconds", r.propagateSeconds },
+				{ "collect_seconds", r.collectSeconds },
+				{ "summarise_seconds", r.summariseSeconds },
+				{ "samples_per_second", static_cast<double>(r.size) / seconds },
+				{ "propagate_samples_per_second", static_cast<double>(r.size) / r.propagateSeconds },
+				{ "efficiency", r.efficiency },
+				{ "propagate_efficiency", r.propagateEfficiency },
+				{ "mean", r.mean },
+				{ "std", r.std }
+			};
+			os << (i == 0 ? "\n" : ",\n") << "    {\"size\": " << r.size << ", \"threads\": " << r.threads;
+			for (const auto& field : fields) {
+				os << ", \"" << field.first << "\": ";
+				Bench::writeNumber(os, field.second);
+			}
+			os << ", \"peak_rss_kb\": " << r.peakRss << "}";
+		}
+		os << "\n  ]\n}\n";
+	}
+}
+
+int main(int argc, char* argv[]) {
+	try {
+		const Options options = parseOptions(argc, argv);
+		const Normal load(5, 1);
+		const Lognormal wear(0, 0.25);
+		const Unweighted ambient(Normal(20, 5).sample(10000));
+
+		std::vector<Run> runs;
+		for (const std::size_t size : options.sizes) {
+			const std::size_t first = runs.size();
+			for (const unsigned int t : options.threads) {
+				const std::size_t n = options.weak ? size * t : size;
+				runs.push_back(propagate(n, t, load, wear, ambient));
+				Run& run = runs.back();
+				const Run& base = runs[first];
+				const double total = run.propagateSeconds + run.collectSeconds + run.summariseSeconds;
+				const double baseTotal = base.propagateSeconds + base.collectSeconds + base.summariseSeconds;
+				// Strong scaling compares thread-seconds for the same work, weak scaling compares wall time
+				const double work = options.weak ? 1 : static_cast<double>(t) / base.threads;
+				run.efficiency = baseTotal / (total * work);
+				run.propagateEfficiency = base.propagateSeconds / (run.propagateSeconds * work);
+				std::cerr << n << " samples, " << t << " threads: " << total << " s, efficiency " << run.efficiency << std::endl;
+			}
+		}
+
+		if (options.output.empty()) {
+			writeJson(std::cout, options, runs);
+			return 0;
+		}
+		std::ofstream os(options.output);
+		writeJson(os, options, runs);
+		return os ? 0 : 1;
+	} catch (const std::exception& e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+}
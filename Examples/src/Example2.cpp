@@ -1,6 +1,8 @@
 //  Second Example
 
-#include "LogNormal.h"
+#include <cstdio>
+
+#include "Lognormal.h"
 #include "Unweighted.h"
 #include "Translation.h"
 #include "Normal.h"
@@ -1,5 +1,7 @@
 // A simple example with samples
 
+#include <cstdio>
+
 #include "Unweighted.h"
 #include "Weighted.h"
 #include "Translation.h"
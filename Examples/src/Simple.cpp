@@ -1,5 +1,7 @@
 // A Simple Example
 
+#include <cstdio>
+
 #include "Normal.h"
 #include "Translation.h"
 #include "Unweighted.h"
@@ -0,0 +1,142 @@
+/** Arena Object - Header
+ *
+ *	@file 		Arena Memory Resource Class
+ *
+ *	@brief 		Arena Class - Monotonic memory resource handing out aligned blocks from large
+ *				chunks and releasing everything at once, plus an STL allocator adapter so sample
+ *				vectors and scratch buffers can be placed in it
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_ARENA_H
+#define RV_ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+class Arena {
+public:
+	using size_type = std::size_t;
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Value constructor taking the size of the chunks requested from the system
+	 *
+	 *	@param	chunkSize	Bytes requested from the system whenever the arena runs out of space
+	 *	@param	hugePages	Back chunks with transparent huge pages where the platform supports it
+	 */
+	explicit Arena(const size_type chunkSize = 1 << 20, const bool hugePages = false);
+
+	/**	@brief	Arena destructor returning every chunk to the system */
+	~Arena();
+
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	// *------------------------------*
+	// |          ALLOCATION          |
+	// *------------------------------*
+
+	/** @brief		Allocates bytes from the current chunk, requesting a new chunk if it does not fit
+	 *
+	 *	@param	bytes		Number of bytes to allocate
+	 *	@param	alignment	Power of two alignment of the returned block (64 suits SIMD loads)
+	 *	@returns 	Pointer to the allocated block, valid until reset() or destruction
+	 */
+	void* allocate(const size_type bytes, const size_type alignment = DEFAULT_ALIGNMENT);
+
+	/** @brief		Releases every allocation in O(1), keeping the chunks for reuse */
+	void reset();
+
+	/** @brief		Retrieves the number of bytes handed out since the last reset()
+	 *
+	 *	@returns	Bytes in use, including alignment padding
+	 */
+	inline size_type getUsed() const {
+		return used;
+	}
+
+	/** @brief		Retrieves the number of bytes requested from the system
+	 *
+	 *	@returns	Total size of all chunks
+	 */
+	inline size_type getCapacity() const {
+		return capacity;
+	}
+
+	static const size_type DEFAULT_ALIGNMENT = 64;
+
+private:
+	/** @brief	Chunk of memory requested from the system */
+	struct Chunk {
+		char* memory;
+		size_type size;
+	};
+
+	/** @brief		Moves to the next chunk able to hold bytes at alignment, requesting one if needed */
+	void nextChunk(const size_type bytes, const size_type alignment);
+
+	std::vector<Chunk> chunks;
+	size_type current;
+	size_type offset;
+	size_type used;
+	size_type chunkSize;
+	size_type capacity;
+	bool hugePages;
+};
+
+/** @brief		STL allocator handing out memory from an Arena
+ *
+ *	@remark		deallocate() is a no-op; memory is reclaimed by Arena::reset()
+ *	@example	Arena arena;
+ *				ArenaAllocator<double> alloc(arena);
+ *				std::vector<double, ArenaAllocator<double>> v = normal.sample(1000, alloc);
+ */
+template<typename T>
+class ArenaAllocator {
+public:
+	using value_type = T;
+
+	explicit ArenaAllocator(Arena& a) : arena(&a) {}
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+	inline T* allocate(const std::size_t n) {
+		return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T) > Arena::DEFAULT_ALIGNMENT ? alignof(T) : Arena::DEFAULT_ALIGNMENT));
+	}
+
+	inline void deallocate(T*, const std::size_t) {}
+
+	inline Arena* getArena() const {
+		return arena;
+	}
+
+	template<typename U>
+	struct rebind {
+		using other = ArenaAllocator<U>;
+	};
+
+private:
+	Arena* arena;
+};
+
+template<typename T, typename U>
+inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+	return a.getArena() == b.getArena();
+}
+
+template<typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+	return !(a == b);
+}
+
+#endif //RV_ARENA_H
@@ -0,0 +1,152 @@
+/** Binning Object - Header
+ *
+ *	@file 		Value Binning Policy
+ *
+ *	@brief 		Binning Class - Policy mapping a value to the representative value of its bin. Weighted applies it
+ *				on construction and append, so continuous data collapses into a bounded number of value -
+ *				frequency pairs instead of one pair per distinct double
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_BINNING_H
+#define RV_BINNING_H
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+/** @brief		Quantisation policy of Weighted values
+ *
+ *	@example	Weighted w(samples, Binning::absolute(0.01));	// values rounded to the nearest multiple of 0.01
+ *				Weighted w(samples, Binning::relative(1e-3));	// bins 0.1% wide relative to the value
+ *				Weighted w(samples, Binning::logarithmic(100));	// 100 bins per decade
+ */
+class Binning {
+public:
+	enum class Type {
+		EXACT,			// values equal within isDoubleEqual() share a pair
+		ABSOLUTE,		// bins of a fixed width centred on multiples of the width
+		RELATIVE,		// bins whose width is a fixed fraction of the magnitude of the value
+		LOGARITHMIC		// bins of equal width in log10 of the magnitude of the value
+	};
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/**	@brief		Default constructor creating the exact policy */
+	constexpr Binning() : type(Type::EXACT), step(0) {}
+
+	/** @brief		Exact policy, the behaviour of Weighted without binning */
+	static Binning exact() {
+		return Binning();
+	}
+
+	/** @brief		Bins of a fixed width
+	 *
+	 *	@param	width	Bin width
+	 *	@throws		std::invalid_argument exception if width is not positive
+	 */
+	static Binning absolute(const double width) {
+		return Binning(Type::ABSOLUTE, checkPositive(width));
+	}
+
+	/** @brief		Bins whose width is a fraction of the value (the mantissa is rounded to multiples of tolerance)
+	 *
+	 *	@param	tolerance	Relative bin width, e.g. 1e-3
+	 *	@throws		std::invalid_argument exception if tolerance is not positive
+	 */
+	static Binning relative(const double tolerance) {
+		return Binning(Type::RELATIVE, checkPositive(tolerance));
+	}
+
+	/** @brief		Relative bins n units in the last place wide */
+	static Binning ulps(const unsigned int n) {
+		return relative(n * std::numeric_limits<double>::epsilon());
+	}
+
+	/** @brief		Bins of equal width in log10 of the magnitude
+	 *
+	 *	@param	binsPerDecade	Number of bins between consecutive powers of 10
+	 *	@throws		std::invalid_argument exception if binsPerDecade is not positive
+	 */
+	static Binning logarithmic(const double binsPerDecade) {
+		return Binning(Type::LOGARITHMIC, std::log(10.0) / checkPositive(binsPerDecade));
+	}
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves the type of the policy	*/
+	constexpr Type getType() const {
+		return type;
+	}
+
+	/** @brief		Retrieves the bin width of the absolute policy, the relative width of the relative policy or
+	 *				the width in natural log of the logarithmic policy (0 for the exact policy)
+	 */
+	constexpr double getStep() const {
+		return step;
+	}
+
+	/** @brief		Checks if every value keeps its own pair	*/
+	constexpr bool isExact() const {
+		return type == Type::EXACT;
+	}
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Maps a value to the representative value of its bin
+	 *
+	 *	@remark		Representatives are canonical, so binned values can be compared with ==. Zero and
+	 *				non-finite values are their own representative in the relative and logarithmic policies
+	 *	@param	x	Any real number
+	 *	@returns	x for the exact policy, otherwise the centre of the bin holding x
+	 */
+	inline double bin(const double x) const {
+		switch (type) {
+		case Type::ABSOLUTE:
+			return std::floor(x / step + 0.5) * step;
+		case Type::RELATIVE: {
+			if (std::fpclassify(x) == FP_ZERO || !std::isfinite(x)) {
+				return x;
+			}
+			int e;
+			const double m = std::frexp(x, &e);
+			return std::ldexp(std::floor(m / step + 0.5) * step, e);
+		}
+		case Type::LOGARITHMIC: {
+			if (std::fpclassify(x) == FP_ZERO || !std::isfinite(x)) {
+				return x;
+			}
+			const double magnitude = std::exp(std::floor(std::log(std::fabs(x)) / step + 0.5) * step);
+			return x < 0 ? -magnitude : magnitude;
+		}
+		default:
+			return x;
+		}
+	}
+
+private:
+	constexpr Binning(const Type t, const double s) : type(t), step(s) {}
+
+	static double checkPositive(const double x) {
+		if (!(x > 0)) {
+			throw std::invalid_argument("Bin width of a Binning policy must be positive");
+		}
+		return x;
+	}
+
+	Type type;
+	double step;		// bin width, relative mantissa width or width in natural log
+};
+#endif //RV_BINNING_H
@@ -0,0 +1,243 @@
+/** Compressed Object - Header
+ *
+ *	@file 		Compressed Sample Class
+ *
+ *	@brief 		Compressed Sample Class - Value - frequency set stored as variable-length encoded blocks of
+ *				sorted pairs. Values are delta encoded and frequencies are varints; each block records its
+ *				minimum, maximum and the number of values before it, so reductions decode the blocks as a
+ *				stream and get(k) decodes a single block
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_NPAR_COMPRESSED_H
+#define RV_NPAR_COMPRESSED_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "NonParametric.h"
+#include "Binning.h"
+#include "Kernels.h"
+
+class Weighted;
+
+/** @brief		Compressed, sorted value - frequency set for large or archived data
+ *
+ *	@remark		A set binned with Binning::absolute() stores the integer bin index of each value, whose deltas
+ *				usually take one byte; other sets store deltas of the order-preserving bit pattern of the
+ *				values. Decoding is exact in both cases
+ *	@example	Weighted w(samples, Binning::absolute(0.001));
+ *				Compressed c(w);	// c.getBytes() is a fraction of 16 * w.getNumPairs()
+ *				c.mean() == w.mean(); c.get(k) == w.get(k); // True
+ */
+class Compressed: public NonParametric {
+public:
+	/**	@brief	Number of pairs encoded in a block on construction */
+	static constexpr size_type BLOCK_PAIRS = 128;
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Compresses a Weighted set, keeping its binning policy for later appends
+	 *
+	 *	@param	w	Weighted sample set
+	 */
+	explicit Compressed(const Weighted& w);
+
+	/** @brief		Compresses value - frequency pairs in any order; equal values are merged
+	 *
+	 *	@param	pv		A vector of pairs (std::pair<double, unsigned int>)
+	 *	@param	binning	Policy applied to the values, exact by default
+	 */
+	explicit Compressed(const pvector_type& pv, const Binning& binning = Binning());
+
+	/**	@brief	Compressed destructor if destructor is called on a RandomVariable pointer */
+	~Compressed();
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves number of values (sum of the frequencies)	*/
+	inline size_type getSize() const {
+		return size;
+	}
+
+	/** @brief		Retrieves number of value - frequency pairs	*/
+	inline size_type getNumPairs() const {
+		return numPairs;
+	}
+
+	/** @brief		Retrieves the memory used by the encoded pairs and the block index	*/
+	inline size_type getBytes() const {
+		return encodedBytes + blocks.size() * sizeof(Block);
+	}
+
+	/** @brief		Checks if values are stored as integer bin indices	*/
+	inline bool isGrid() const {
+		return grid;
+	}
+
+	/** @brief		Retrieves the value of rank k in ascending order, decoding one block
+	 *
+	 *	@param	k	Zero-indexed rank
+	 *	@throws		std::out_of_range exception
+	 */
+	double get(const size_type k) const;
+
+	/** @brief		Appends a value, re-encoding the block it falls into
+	 *
+	 *	@remark		Each block owns its encoded bytes, so the cost is one block plus an update of the block
+	 *				index (O(number of pairs / BLOCK_PAIRS)), not a shift of every encoded byte
+	 *	@param	d	Any real number, binned with the policy of the set
+	 */
+	void append(const double d);
+
+	/** @brief		Returns the values in ascending order, each repeated by its frequency	*/
+	vector_type getData() const;
+
+	/** @brief		Returns the decoded pairs in ascending order of value	*/
+	pvector_type getWData() const;
+
+	/** @brief		Calls f(value, frequency) on every pair in ascending order of value, decoding block by block */
+	template<typename F>
+	void forEach(F f) const {
+		for (const Block& b : blocks) {
+			decode(b, f);
+		}
+	}
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Mean, median, population standard deviation (as Weighted) and mode of the set
+	 *
+	 *	@throws		std::invalid_argument exception from median() if the set is empty
+	 */
+	double mean() const;
+	double median() const;
+	double std() const;
+	double mode() const;
+
+	/** @brief		Calculates mean value frequency within the set	*/
+	double meanHeight() const;
+
+	/** @brief		Number of values smaller than or equal to x, skipping whole blocks by their minimum and maximum */
+	size_type countAtMost(const double x) const;
+
+	// *------------------------------*
+	// |          SAMPLING            |
+	// *------------------------------*
+
+	/** @brief 		Resamples a single value uniformly	*/
+	double sampleSingle() const;
+
+	using RandomVariable::sample;
+
+	/** @brief 		Resamples multiple values uniformly with replacement
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Empirical quantile (value of rank y * (N - 1))
+	 *
+	 *	@param	y	Cumulative probability in [0,1]
+	 *	@throws		std::invalid_argument exception if y is outside [0,1] or the set is empty
+	 */
+	double sampleSingleIcdf(const double y) const;
+
+	/** @brief 		Empirical quantiles for each probability in v
+	 *
+	 *	@throws		std::invalid_argument exception if n differs from the size of v
+	 */
+	vector_type sampleIcdf(const unsigned int n, const vector_type& v) const;
+
+	// *------------------------------*
+	// |           VISUAL             |
+	// *------------------------------*
+
+	/** @brief		Prints the pairs for testing purposes */
+	void printData() const;
+
+private:
+	/**	@brief	Index entry of an encoded block */
+	struct Block {
+		double min;					// first value, stored raw
+		double max;					// last value
+		size_type countBefore;		// number of values in earlier blocks
+		size_type count;			// number of values in the block
+		size_type pairs;
+		std::vector<std::uint8_t> bytes;	// encoded pairs
+	};
+
+	/** @brief		Encodes sorted, distinct pairs into blocks appended to blocks */
+	void encode(const pvector_type& pv);
+
+	/** @brief		Encodes sorted, distinct pairs as one block */
+	Block encodeBlock(pvector_type::const_iterator first, pvector_type::const_iterator last) const;
+
+	/** @brief		Calls f(value, frequency) on every pair of a block */
+	template<typename F>
+	void decode(const Block& b, F f) const;
+
+	/** @brief		Reads a little-endian base-128 varint and advances p past it	*/
+	static inline std::uint64_t readVarint(const std::uint8_t*& p) {
+		std::uint64_t x = 0;
+		for (unsigned int shift = 0; ; shift += 7) {
+			const std::uint8_t byte = *p++;
+			x |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if (byte < 0x80) {
+				return x;
+			}
+		}
+	}
+
+	/** @brief		Decodes the pairs of a block	*/
+	pvector_type decodeBlock(const Block& b) const;
+
+	/** @brief		Index of the block holding the value of rank k	*/
+	size_type findRank(const size_type k) const;
+
+	std::vector<Block> blocks;
+	size_type encodedBytes;		// sum of the encoded sizes of the blocks
+	size_type size;
+	size_type numPairs;
+	Binning binning;
+	bool grid;			// values are multiples of the absolute bin width, stored as integer indices
+};
+template<typename F>
+void Compressed::decode(const Block& b, F f) const {
+	const std::uint8_t* p = b.bytes.data();
+	if (grid) {
+		const double step = binning.getStep();
+		double value = b.min;
+		std::int64_t k = std::llround(b.min / step);
+		for (size_type i = 0; i < b.pairs; i++) {
+			if (i > 0) {
+				k += static_cast<std::int64_t>(readVarint(p));
+				value = static_cast<double>(k) * step;
+			}
+			f(value, static_cast<unsigned int>(readVarint(p)));
+		}
+	} else {
+		std::uint64_t bits = Kernels::toOrderedBits(b.min);
+		for (size_type i = 0; i < b.pairs; i++) {
+			if (i > 0) {
+				bits += readVarint(p);
+			}
+			f(Kernels::fromOrderedBits(bits), static_cast<unsigned int>(readVarint(p)));
+		}
+	}
+}
+#endif //RV_NPAR_COMPRESSED_H
@@ -0,0 +1,180 @@
+/** Decaying Object - Header
+ *
+ *	@file 		Exponentially Decaying Sample Class
+ *
+ *	@brief 		Decaying Sample Class - Summary of a data stream in which every value's weight halves after
+ *				a configurable number of later appends. Mean, variance and a set of quantile estimates are
+ *				updated in O(1) per append and no values are stored, so statistics follow a drifting source
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_NPAR_DECAYING_H
+#define RV_NPAR_DECAYING_H
+
+#include "NonParametric.h"
+
+/** @brief		Exponentially weighted summary of a stream
+ *
+ *	@remark		mean(), std() and mode() are O(1), so Translation::fit<Normal>(&d) re-fits at constant cost
+ *				after every append. Quantiles are stochastic approximations tracked at fixed probabilities,
+ *				relative to the decayed mean and standard deviation and starting from a normal shape;
+ *				the data accessors (get(), getData(), getWData()) return these estimates since no values are kept
+ *	@example	Decaying d(100); // weight of a value halves after 100 later values
+ *				for (double x : stream) { d.append(x); Normal n = Translation::fit<Normal>(&d); }
+ */
+class Decaying: public NonParametric {
+public:
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Constructs an empty summary
+	 *
+	 *	@param	halfLife		Number of appends after which a value has half of its weight
+	 *	@param	probabilities	Cumulative probabilities in (0,1) whose quantiles are tracked; 0.5 is always tracked
+	 *	@throws		std::invalid_argument exception if halfLife is not positive or a probability is outside (0,1)
+	 */
+	explicit Decaying(const double halfLife, const vector_type& probabilities = { 0.05, 0.25, 0.5, 0.75, 0.95 });
+
+	/** @brief		Constructs a summary and appends values in order
+	 *
+	 *	@param	halfLife		Number of appends after which a value has half of its weight
+	 *	@param	probabilities	Cumulative probabilities in (0,1) whose quantiles are tracked
+	 *	@param	v				Values, oldest first
+	 */
+	Decaying(const double halfLife, const vector_type& probabilities, const vector_type& v);
+
+	/**	@brief	Decaying destructor if destructor is called on a RandomVariable pointer */
+	~Decaying();
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves number of values appended	*/
+	inline size_type getSize() const {
+		return count;
+	}
+
+	/** @brief		Retrieves the half-life in appends	*/
+	inline double getHalfLife() const {
+		return halfLife;
+	}
+
+	/** @brief		Retrieves the sum of the decayed weights of all values appended
+	 *
+	 *	@returns	Effective number of values, approaching 1 / (1 - 2^(-1/halfLife))
+	 */
+	inline double getWeight() const {
+		return weight;
+	}
+
+	/** @brief		Retrieves the tracked cumulative probabilities in increasing order	*/
+	inline const vector_type& getProbabilities() const {
+		return probabilities;
+	}
+
+	/** @brief		Appends a value, decaying the weight of all earlier values
+	 *
+	 *	@param	d	Any real number
+	 */
+	void append(const double d);
+
+	/** @brief		Retrieves the quantile estimate of the kth tracked probability
+	 *
+	 *	@param	k	Zero-indexed position in getProbabilities()
+	 *	@throws		std::out_of_range exception
+	 */
+	double get(const size_type k) const;
+
+	/** @brief		Returns the quantile estimates of the tracked probabilities	*/
+	vector_type getData() const;
+
+	/** @brief		Returns the quantile estimates, each with frequency 1	*/
+	pvector_type getWData() const;
+
+	/** @brief		Forgets all values */
+	void clear();
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Decayed mean, sample standard deviation and sample variance
+	 *
+	 *	@remark		The variance uses the reliability-weighted correction, which equals the n - 1
+	 *				denominator of Unweighted when nothing has decayed; it is 0 for fewer than 2 values or
+	 *				when earlier weights have underflowed (half-lives far below one append)
+	 */
+	double mean() const;
+	double std() const;
+	double variance() const;
+
+	/** @brief		Quantile estimate at probability 0.5 */
+	double median() const;
+
+	/** @brief		Estimates the mode with Pearson's relation 3 * median - 2 * mean, since no values are kept */
+	double mode() const;
+
+	/** @brief		Returns 1, every quantile estimate having frequency 1	*/
+	double meanHeight() const;
+
+	// *------------------------------*
+	// |          SAMPLING            |
+	// *------------------------------*
+
+	/** @brief 		Samples a single value from the interpolated quantile estimates	*/
+	double sampleSingle() const;
+
+	using RandomVariable::sample;
+
+	/** @brief 		Samples multiple values from the interpolated quantile estimates
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Quantile at probability y, linearly interpolated between the tracked estimates and
+	 *				clamped to the outermost ones
+	 *
+	 *	@param	y	Cumulative probability in [0,1]
+	 *	@throws		std::invalid_argument exception if y is outside [0,1] or nothing was appended
+	 */
+	double sampleSingleIcdf(const double y) const;
+
+	/** @brief 		Interpolated quantiles for each probability in v
+	 *
+	 *	@throws		std::invalid_argument exception if n differs from the size of v
+	 */
+	vector_type sampleIcdf(const unsigned int n, const vector_type& v) const;
+
+	// *------------------------------*
+	// |           VISUAL             |
+	// *------------------------------*
+
+	/** @brief		Prints probability - quantile estimate pairs for testing purposes */
+	void printData() const;
+
+private:
+	/** @brief		Starts the quantile estimates at the standard normal quantiles */
+	void initShape();
+
+	double halfLife;
+	double decay;			// weight factor applied to earlier values on every append
+	size_type count;
+	double weight;			// sum of weights
+	double weight2;			// sum of squared weights
+	double runningMean;
+	double squaredDeviations;
+	vector_type probabilities;
+	vector_type zs;			// quantile estimates in standard deviations from the mean
+	size_type medianIndex;
+};
+#endif //RV_NPAR_DECAYING_H
@@ -0,0 +1,226 @@
+/** Distribution Object - Header
+ *
+ *	@file 		Distribution Value Class
+ *
+ *	@brief 		Distribution Class - Value-semantic closed union of the distribution types in the library
+ *				(Normal, Lognormal, Unweighted, Weighted). Dispatch is a switch on the stored type that is
+ *				hoisted out of the batch functions, so collections of distributions can live contiguously in
+ *				a std::vector and be evaluated without virtual calls in the inner loops
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_DISTRIBUTION_H
+#define RV_DISTRIBUTION_H
+
+#include <stdexcept>
+#include <utility>
+
+#include "Normal.h"
+#include "Lognormal.h"
+#include "Unweighted.h"
+#include "Weighted.h"
+
+class Distribution {
+public:
+	using size_type = RandomVariable::size_type;
+
+	/** @brief	Types a Distribution object can hold */
+	enum class Type { NORMAL, LOGNORMAL, UNWEIGHTED, WEIGHTED };
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Value constructors taking a copy of one of the supported distributions
+	 *
+	 *	@remark		Not explicit, so a Normal can be pushed into a std::vector<Distribution> directly
+	 *	@param	d	Distribution to hold
+	 */
+	Distribution(const Normal& d);
+	Distribution(const Lognormal& d);
+	Distribution(Unweighted d);
+	Distribution(Weighted d);
+
+	/**	@brief	Copy and move constructors/assignment
+	 *
+	 *	@remark		Moves are noexcept, so a growing std::vector<Distribution> moves its elements instead of
+	 *				copying every held data set; copy assignment leaves this object unchanged if the copy throws
+	 */
+	Distribution(const Distribution& other);
+	Distribution(Distribution&& other) noexcept;
+	Distribution& operator=(const Distribution& other);
+	Distribution& operator=(Distribution&& other) noexcept;
+
+	/**	@brief	Distribution destructor destroying the held distribution */
+	~Distribution();
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves the type of the held distribution
+	 *
+	 *	@returns	Type enumerator
+	 */
+	inline Type getType() const {
+		return type;
+	}
+
+	/** @brief		Checks whether the held distribution is parametric (supports pdf/cdf/icdf)
+	 *
+	 *	@returns	True for Normal and Lognormal
+	 */
+	inline bool isParametric() const {
+		return type == Type::NORMAL || type == Type::LOGNORMAL;
+	}
+
+	/** @brief		Retrieves the held distribution through the RandomVariable interface
+	 *
+	 *	@remark		Calls through the returned reference are virtual again; use it for interoperability only
+	 *	@returns	Reference to the held distribution
+	 */
+	const RandomVariable& getRandomVariable() const;
+
+	/** @brief		Retrieves the held distribution as its concrete type
+	 *
+	 *	@throws		std::invalid_argument exception if the held distribution is not a T
+	 *	@returns	Reference to the held distribution
+	 *	@example	Distribution d(Normal(0, 1));
+	 *				d.get<Normal>().getSigma() == 1; // True
+	 */
+	template<typename T>
+	const T& get() const;
+
+	/** @brief		Calls f with the held distribution as its concrete type
+	 *
+	 *	@remark		f must accept const Normal&, const Lognormal&, const Unweighted& and const Weighted&
+	 *				and return the same type for all of them
+	 *	@param	f	Visitor function object
+	 *	@returns 	Result of f
+	 */
+	template<typename F>
+	auto visit(F f) const -> decltype(f(std::declval<const Normal&>()));
+
+	// *------------------------------*
+	// |     	 CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Statistics of the held distribution, dispatched without virtual calls */
+	double mean() const;
+	double median() const;
+	double std() const;
+	double mode() const;
+	double variance() const;
+
+	/** @brief		Probability density, cumulative density and inverse cumulative density of the held distribution
+	 *
+	 *	@throws		std::invalid_argument exception if the held distribution is not parametric
+	 */
+	double pdf(const double x) const;
+	double cdf(const double x) const;
+	double icdf(const double y) const;
+
+	/** @brief		Batch versions evaluating n inputs; the type switch happens once per call
+	 *
+	 *	@param	n	Number of values in in and out
+	 *	@param	in	Input values
+	 *	@param	out	Buffer with room for at least n doubles, may alias in
+	 *	@throws		std::invalid_argument exception if the held distribution is not parametric
+	 */
+	void pdf(const size_type n, const double* in, double* out) const;
+	void cdf(const size_type n, const double* in, double* out) const;
+	void icdf(const size_type n, const double* in, double* out) const;
+
+	// *------------------------------*
+	// |          SAMPLING            |
+	// *------------------------------*
+
+	/** @brief 		Sample of multiple values from the held distribution
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Sample of multiple values from the held distribution
+	 *
+	 *	@param	n	Number of samples to return within the vector
+	 *	@returns 	A std::vector<double> of sample values
+	 */
+	RandomVariable::vector_type sample(const unsigned int n) const;
+
+private:
+	/** @brief	Copy/move constructs the held distribution of other into the (empty) union */
+	void construct(const Distribution& other);
+	void construct(Distribution&& other) noexcept;
+
+	/** @brief	Destroys the held distribution */
+	void destroy();
+
+	/** @brief	Throws unless the held distribution is parametric */
+	void requireParametric(const char* function) const;
+
+	Type type;
+	// The tag plus the largest member, 64 bytes on LP64 platforms (Weighted: data, size and Binning)
+	union {
+		Normal normal;
+		Lognormal lognormal;
+		Unweighted unweighted;
+		Weighted weighted;
+	};
+};
+
+template<>
+inline const Normal& Distribution::get<Normal>() const {
+	if (type != Type::NORMAL) {
+		throw std::invalid_argument("Distribution does not hold a Normal");
+	}
+	return normal;
+}
+
+template<>
+inline const Lognormal& Distribution::get<Lognormal>() const {
+	if (type != Type::LOGNORMAL) {
+		throw std::invalid_argument("Distribution does not hold a Lognormal");
+	}
+	return lognormal;
+}
+
+template<>
+inline const Unweighted& Distribution::get<Unweighted>() const {
+	if (type != Type::UNWEIGHTED) {
+		throw std::invalid_argument("Distribution does not hold an Unweighted");
+	}
+	return unweighted;
+}
+
+template<>
+inline const Weighted& Distribution::get<Weighted>() const {
+	if (type != Type::WEIGHTED) {
+		throw std::invalid_argument("Distribution does not hold a Weighted");
+	}
+	return weighted;
+}
+
+template<typename F>
+auto Distribution::visit(F f) const -> decltype(f(std::declval<const Normal&>())) {
+	switch (type) {
+	case Type::NORMAL:
+		return f(normal);
+	case Type::LOGNORMAL:
+		return f(lognormal);
+	case Type::UNWEIGHTED:
+		return f(unweighted);
+	case Type::WEIGHTED:
+		return f(weighted);
+	default:
+		throw std::invalid_argument("Distribution holds an unknown type");
+	}
+}
+#endif //RV_DISTRIBUTION_H
@@ -0,0 +1,140 @@
+/** Ingest Object - Header
+ *
+ *	@file 		Concurrent Ingest Class
+ *
+ *	@brief 		Ingest Class - Collects values appended concurrently by many producer threads and drains them
+ *				into a NonParametric data set. Each producer fills a private block without synchronisation and
+ *				publishes full blocks onto a lock-free stack; flush() takes the whole stack with one atomic
+ *				exchange and appends its values to the data set
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_INGEST_H
+#define RV_INGEST_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "NonParametric.h"
+
+/** @brief		Multi-producer ingest into a NonParametric data set
+ *
+ *	@remark		Producer::append() is a store into a thread-private block; a block is published after
+ *				BLOCK_SIZE values or on Producer::flush(). Ingest::flush() must be called from one thread at a
+ *				time and is the only function touching the data set, which must not be read concurrently
+ *				with it. Blocks are drained in publication order; values of different producers interleave
+ *				by block
+ *	@example	Unweighted uw({});
+ *				Ingest ingest(uw);
+ *				Parallel::run(8, [&](unsigned int) { Ingest::Producer p = ingest.producer(); for (...) p.append(x); });
+ *				ingest.flush(); // uw holds every value
+ */
+class Ingest {
+public:
+	using size_type = std::size_t;
+
+	/**	@brief	Number of values in a block */
+	static constexpr size_type BLOCK_SIZE = 4096;
+
+	/**	@brief	Fixed-size buffer of values, linked into the published stack */
+	struct Block {
+		Block* next;
+		size_type size;
+		double values[BLOCK_SIZE];
+	};
+
+	/**	@brief	Per-thread handle appending values into its own block
+	 *
+	 *	@remark	Must not be shared between threads or outlive its Ingest. The destructor publishes the
+	 *			values still in the block without allocating. A moved-from Producer may only be flushed
+	 *			(a no-op) or destroyed
+	 */
+	class Producer {
+	public:
+		Producer(Producer&& other) noexcept;
+		Producer(const Producer&) = delete;
+		Producer& operator=(const Producer&) = delete;
+		Producer& operator=(Producer&&) = delete;
+		~Producer();
+
+		/** @brief		Appends a value, publishing the block when it is full
+		 *
+		 *	@pre		The Producer has not been moved from; the hot path does not check
+		 *	@param	d	Any real number
+		 */
+		inline void append(const double d) {
+			block->values[block->size++] = d;
+			if (block->size == BLOCK_SIZE) {
+				publish();
+			}
+		}
+
+		/** @brief		Publishes the values appended so far so the next Ingest::flush() drains them
+		 *
+		 *	@remark		Does nothing on a moved-from Producer
+		 */
+		void flush();
+
+	private:
+		friend class Ingest;
+
+		explicit Producer(Ingest& owner);
+
+		/** @brief		Pushes the current block onto the stack of its Ingest and starts a new one */
+		void publish();
+
+		Ingest* ingest;
+		Block* block;
+	};
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Constructs an ingest draining into a data set
+	 *
+	 *	@param	target	Data set receiving the values; must outlive the Ingest
+	 */
+	explicit Ingest(NonParametric& target);
+
+	Ingest(const Ingest&) = delete;
+	Ingest& operator=(const Ingest&) = delete;
+
+	/**	@brief	Discards blocks that were published but not flushed */
+	~Ingest();
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Creates a handle for the calling producer thread	*/
+	Producer producer();
+
+	/** @brief		Appends every published value to the data set
+	 *
+	 *	@remark		Values still in a producer's private block are not included until it flushes
+	 *	@remark		If appending to the data set throws, the blocks not yet drained, including the one being
+	 *				appended, are published again and the exception is rethrown; the next flush() retries
+	 *				them, after any blocks published in the meantime. Values of the failing block that the
+	 *				data set took before throwing may then be appended twice
+	 *	@returns	Number of values appended
+	 */
+	size_type flush();
+
+private:
+	/** @brief		Lock-free push of a full block; only whole-stack removal exists, so there is no ABA */
+	void push(Block* b);
+
+	/** @brief		Lock-free push of a chain of blocks linked from newest to oldest */
+	void push(Block* newest, Block* oldest);
+
+	NonParametric& target;
+	std::atomic<Block*> head;
+};
+#endif //RV_INGEST_H
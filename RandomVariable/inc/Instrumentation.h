@@ -0,0 +1,116 @@
+/** Instrumentation Namespace - Header
+ *
+ *	@file 		Instrumentation Namespace
+ *
+ *	@brief 		Instrumentation Namespace - Per-operation counters (calls, samples generated, bytes allocated,
+ *				cumulative time) for the hot paths of the library. Counters accumulate in thread-local blocks
+ *				and are summed on demand by snapshot()
+ *	@note		Recording is compiled in only when RV_INSTRUMENTATION is defined (CMake option of the same
+ *				name); otherwise the RV_INSTRUMENT_* macros expand to nothing and snapshot() returns zeros
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_INSTRUMENTATION_H
+#define RV_INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Instrumentation {
+	/** @brief		Instrumented operations
+	 *
+	 *	@details	SAMPLE				sample() of every distribution
+	 *				ICDF				batch sampleIcdf() of parametric distributions
+	 *				STATISTICS			mean(), median(), std() and mode() of data sets
+	 *				TRANSLATION_SAMPLE	Translation::sample()
+	 *				TRANSLATION_FIT		Translation::fit()
+	 *	@remark		Times are inclusive, so Translation::sample() also counts the SAMPLE call it makes
+	 */
+	enum class Operation : unsigned int {SAMPLE, ICDF, STATISTICS, TRANSLATION_SAMPLE, TRANSLATION_FIT, COUNT};
+
+	constexpr std::size_t OPERATION_COUNT = static_cast<std::size_t>(Operation::COUNT);
+
+#ifdef RV_INSTRUMENTATION
+	constexpr bool enabled = true;
+#else
+	constexpr bool enabled = false;
+#endif
+
+	/** @brief		Accumulated counters of one operation */
+	struct Counters {
+		std::uint64_t calls;
+		std::uint64_t samples;
+		std::uint64_t bytes;
+		std::uint64_t nanoseconds;
+	};
+
+	/** @brief		Counters of every operation summed over all threads at one point in time */
+	struct Snapshot {
+		Counters counters[OPERATION_COUNT];
+
+		inline const Counters& operator[](const Operation op) const {
+			return counters[static_cast<std::size_t>(op)];
+		}
+	};
+
+	/** @brief		Name of an operation for export (e.g. "sample", "translation_fit") */
+	const char* name(const Operation op);
+
+	/** @brief		Sums the counters of all live threads and of threads that have exited
+	 *
+	 *	@returns	Snapshot of all operations (all zeros when instrumentation is disabled)
+	 */
+	Snapshot snapshot();
+
+	/** @brief		Zeroes all counters
+	 *
+	 *	@remark		Counts recorded concurrently with reset() may survive it
+	 */
+	void reset();
+
+	/** @brief		Adds to the counters of op in the calling thread's block */
+	void record(const Operation op, const std::uint64_t calls, const std::uint64_t samples, const std::uint64_t bytes,
+		const std::uint64_t nanoseconds);
+
+	/** @brief		Records one call of op with its samples and elapsed time when it goes out of scope */
+	class ScopedTimer {
+	public:
+		inline ScopedTimer(const Operation o, const std::uint64_t n) : op(o), samples(n), start(std::chrono::steady_clock::now()) {}
+
+		inline ~ScopedTimer() {
+			const auto elapsed = std::chrono::steady_clock::now() - start;
+			record(op, 1, samples, 0, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		const Operation op;
+		const std::uint64_t samples;
+		const std::chrono::steady_clock::time_point start;
+	};
+}
+
+/**	@brief	RV_INSTRUMENT_SCOPE times the rest of the enclosing scope as one call of Instrumentation::Operation::op
+ *			producing samples values; RV_INSTRUMENT_BYTES adds bytes allocated on behalf of op (returned vectors
+ *			and copies of the data set, not small scratch buffers such as the mode list of Unweighted::mode())
+ */
+#ifdef RV_INSTRUMENTATION
+#define RV_INSTRUMENT_SCOPE(op, samples) \
+	const Instrumentation::ScopedTimer rvInstrumentScope(Instrumentation::Operation::op, static_cast<std::uint64_t>(samples))
+#define RV_INSTRUMENT_BYTES(op, bytes) \
+	Instrumentation::record(Instrumentation::Operation::op, 0, 0, static_cast<std::uint64_t>(bytes), 0)
+#else
+#define RV_INSTRUMENT_SCOPE(op, samples) static_cast<void>(0)
+#define RV_INSTRUMENT_BYTES(op, bytes) static_cast<void>(0)
+#endif
+
+#endif //RV_INSTRUMENTATION_H
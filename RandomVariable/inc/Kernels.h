@@ -0,0 +1,335 @@
+/** Kernels Namespace - Header
+ *
+ *	@file 		Kernels Namespace
+ *
+ *	@brief 		Kernels Namespace - Header-only numerical cores of the library (normal quantile, pdf/cdf/icdf
+ *				formulas and data set reductions). The distribution classes delegate to these functions, and
+ *				the statically polymorphic kernel types can be used directly in user loops so the compiler is
+ *				able to inline and vectorize the distribution math together with user code
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_KERNELS_H
+#define RV_KERNELS_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Kernels {
+	// *------------------------------*
+	// |     	  CONSTANTS           |
+	// *------------------------------*
+
+	constexpr double SQRT_2 = 1.41421356237309504880;
+	constexpr double SQRT_2PI = 2.50662827463100050242;
+
+	/**	Coefficients of ALGORITHM AS241 APPL. STATIST. (1988) VOL. 37, NO. 3, highest degree first.
+	 *	The central region covers 0.075 <= p <= 0.925, the intermediate region min(p, 1-p) >= exp(-25)
+	 *	and the tail region the remainder.
+	 */
+	constexpr double AS241_CENTRAL_NUM[] = { 2509.0809287301226727, 33430.575583588128105, 67265.770927008700853,
+		45921.953931549871457, 13731.693765509461125, 1971.5909503065514427, 133.14166789178437745, 3.387132872796366608 };
+	constexpr double AS241_CENTRAL_DEN[] = { 5226.495278852854561, 28729.085735721942674, 39307.89580009271061,
+		21213.794301586595867, 5394.1960214247511077, 687.1870074920579083, 42.313330701600911252, 1 };
+	constexpr double AS241_INTERMEDIATE_NUM[] = { 7.7454501427834140764e-4, .0227238449892691845833, .24178072517745061177,
+		1.27045825245236838258, 3.64784832476320460504, 5.7694972214606914055, 4.6303378461565452959, 1.42343711074968357734 };
+	constexpr double AS241_INTERMEDIATE_DEN[] = { 1.05075007164441684324e-9, 5.475938084995344946e-4, .0151986665636164571966,
+		.14810397642748007459, .68976733498510000455, 1.6763848301838038494, 2.05319162663775882187, 1 };
+	constexpr double AS241_TAIL_NUM[] = { 2.01033439929228813265e-7, 2.71155556874348757815e-5, .0012426609473880784386,
+		.026532189526576123093, .29656057182850489123, 1.7848265399172913358, 5.4637849111641143699, 6.6579046435011037772 };
+	constexpr double AS241_TAIL_DEN[] = { 2.04426310338993978564e-15, 1.4215117583164458887e-7, 1.8463183175100546818e-5,
+		7.868691311456132591e-4, .0148753612908506148525, .13692988092273580531, .59983220655588793769, 1 };
+
+	// *------------------------------*
+	// |     	  FUNCTIONS           |
+	// *------------------------------*
+
+	/** @brief		Evaluates a polynomial with Horner's method in precision T
+	 *
+	 *	@param	c	Coefficients, highest degree first
+	 *	@param	x	Input value
+	 *	@returns 	c[0] * x^(N-1) + ... + c[N-1]
+	 */
+	template<typename T, std::size_t N>
+	inline T polynomial(const double (&c)[N], const T x) {
+		T val = static_cast<T>(c[0]);
+		for (std::size_t i = 1; i < N; i++) {
+			val = val * x + static_cast<T>(c[i]);
+		}
+		return val;
+	}
+
+	/** @brief		Standard normal quantile (inverse cdf)
+	 *
+	 *	@param	p	Target cumulative probability
+	 *	@pre		p must be in (0,1); 0 and 1 produce nan
+	 *	@returns 	Z such that Phi(Z) = p, accurate to about 1 part in 10**16 for double
+	 * 	@note		Adapted from https://github.com/sdwfrost/libRmath-nim/blob/master/src/qnorm.c (AS241)
+	 */
+	template<typename T>
+	inline T normInv(const T p) {
+		const T q = p - T(0.5);
+		if (std::fabs(q) <= T(.425)) {
+			const T r = T(.180625) - q * q;
+			return q * polynomial(AS241_CENTRAL_NUM, r) / polynomial(AS241_CENTRAL_DEN, r);
+		}
+		// r = sqrt(-log(min(p, 1-p)))  <==>  min(p, 1-p) = exp( - r^2 )
+		T r = std::sqrt(-std::log(q > 0 ? 1 - p : p));
+		T val;
+		if (r <= 5) {
+			r += T(-1.6);
+			val = polynomial(AS241_INTERMEDIATE_NUM, r) / polynomial(AS241_INTERMEDIATE_DEN, r);
+		} else {
+			r += T(-5);
+			val = polynomial(AS241_TAIL_NUM, r) / polynomial(AS241_TAIL_DEN, r);
+		}
+		return q < 0 ? -val : val;
+	}
+
+	/** @brief		Normal probability density, its natural log, cumulative density and inverse cumulative density
+	 *
+	 *	@pre		sigma > 0; y in (0,1) for normalIcdf()
+	 */
+	template<typename T>
+	inline T normalPdf(const T x, const T mu, const T sigma) {
+		const T z = (x - mu) / sigma;
+		return std::exp(T(-0.5) * z * z) / (T(SQRT_2PI) * sigma);
+	}
+
+	template<typename T>
+	inline T normalLogPdf(const T x, const T mu, const T sigma) {
+		const T z = (x - mu) / sigma;
+		return T(-0.5) * z * z - std::log(T(SQRT_2PI) * sigma);
+	}
+
+	template<typename T>
+	inline T normalCdf(const T x, const T mu, const T sigma) {
+		return T(.5) + T(.5) * std::erf((x - mu) / (sigma * T(SQRT_2)));
+	}
+
+	template<typename T>
+	inline T normalIcdf(const T y, const T mu, const T sigma) {
+		return normInv(y) * sigma + mu;
+	}
+
+	/** @brief		Lognormal probability density, its natural log, cumulative density and inverse cumulative density
+	 *
+	 *	@pre		sigma > 0; x > 0 for lognormalPdf(), lognormalLogPdf() and lognormalCdf(); y in (0,1) for lognormalIcdf()
+	 */
+	template<typename T>
+	inline T lognormalPdf(const T x, const T mu, const T sigma) {
+		const T z = (std::log(x) - mu) / sigma;
+		return std::exp(T(-0.5) * z * z) / (x * sigma * T(SQRT_2PI));
+	}
+
+	template<typename T>
+	inline T lognormalLogPdf(const T x, const T mu, const T sigma) {
+		const T z = (std::log(x) - mu) / sigma;
+		return T(-0.5) * z * z - std::log(x * sigma * T(SQRT_2PI));
+	}
+
+	template<typename T>
+	inline T lognormalCdf(const T x, const T mu, const T sigma) {
+		return T(.5) + T(.5) * std::erf((std::log(x) - mu) / (sigma * T(SQRT_2)));
+	}
+
+	template<typename T>
+	inline T lognormalIcdf(const T y, const T mu, const T sigma) {
+		return std::exp(normInv(y) * sigma + mu);
+	}
+
+	/** @brief		Maps a double to an unsigned integer with the same ordering (negative values below positive
+	 *				ones, -0 just below +0), and back. Sorting or delta encoding the integers works on the doubles
+	 */
+	inline std::uint64_t toOrderedBits(const double d) {
+		std::uint64_t u;
+		std::memcpy(&u, &d, sizeof(u));
+		return (u >> 63) != 0 ? ~u : u | (std::uint64_t(1) << 63);
+	}
+
+	inline double fromOrderedBits(const std::uint64_t o) {
+		const std::uint64_t u = (o >> 63) != 0 ? o & ~(std::uint64_t(1) << 63) : ~o;
+		double d;
+		std::memcpy(&d, &u, sizeof(d));
+		return d;
+	}
+
+	// *------------------------------*
+	// |     	  REDUCTIONS          |
+	// *------------------------------*
+
+	/** @brief		Sum and sum of squared deviations from center of a range of values */
+	template<typename It>
+	inline double sum(It first, const It last) {
+		double s = 0;
+		for (; first != last; ++first) {
+			s += *first;
+		}
+		return s;
+	}
+
+	template<typename It>
+	inline double sumSquaredDeviations(It first, const It last, const double center) {
+		double s = 0;
+		for (; first != last; ++first) {
+			const double d = *first - center;
+			s += d * d;
+		}
+		return s;
+	}
+
+	/** @brief		Sum, total frequency and sum of squared deviations from center of a range of value-frequency pairs */
+	template<typename It>
+	inline double weightedSum(It first, const It last) {
+		double s = 0;
+		for (; first != last; ++first) {
+			s += first->first * first->second;
+		}
+		return s;
+	}
+
+	template<typename It>
+	inline double totalWeight(It first, const It last) {
+		double s = 0;
+		for (; first != last; ++first) {
+			s += first->second;
+		}
+		return s;
+	}
+
+	template<typename It>
+	inline double weightedSumSquaredDeviations(It first, const It last, const double center) {
+		double s = 0;
+		for (; first != last; ++first) {
+			const double d = first->first - center;
+			s += d * d * first->second;
+		}
+		return s;
+	}
+
+	// *------------------------------*
+	// |     	   KERNELS            |
+	// *------------------------------*
+
+	/** @brief		Static polymorphism base of the distribution kernels
+	 *	@details	Derived kernels provide scalar pdf(), cdf() and icdf(); the base provides range versions
+	 *				that are resolved at compile time, so a loop over a kernel has no indirect calls
+	 *
+	 *	@example	Kernels::NormalKernel k(0, 1);
+	 *				k.cdf(x.begin(), x.end(), y.begin());
+	 */
+	template<typename Derived>
+	struct Kernel {
+		inline const Derived& derived() const {
+			return static_cast<const Derived&>(*this);
+		}
+
+		template<typename In, typename Out>
+		inline Out pdf(In first, const In last, Out out) const {
+			for (; first != last; ++first, ++out) {
+				*out = derived().pdf(*first);
+			}
+			return out;
+		}
+
+		template<typename In, typename Out>
+		inline Out cdf(In first, const In last, Out out) const {
+			for (; first != last; ++first, ++out) {
+				*out = derived().cdf(*first);
+			}
+			return out;
+		}
+
+		template<typename In, typename Out>
+		inline Out icdf(In first, const In last, Out out) const {
+			for (; first != last; ++first, ++out) {
+				*out = derived().icdf(*first);
+			}
+			return out;
+		}
+	};
+
+	/** @brief	Normal distribution kernel with parameters mu and sigma, evaluated in precision T */
+	template<typename T>
+	struct BasicNormalKernel : Kernel<BasicNormalKernel<T> > {
+		using value_type = T;
+
+		using Kernel<BasicNormalKernel<T> >::pdf;
+		using Kernel<BasicNormalKernel<T> >::cdf;
+		using Kernel<BasicNormalKernel<T> >::icdf;
+
+		constexpr BasicNormalKernel(const T m, const T s) : mu(m), sigma(s) {}
+
+		inline T pdf(const T x) const {
+			return normalPdf(x, mu, sigma);
+		}
+
+		inline T cdf(const T x) const {
+			return normalCdf(x, mu, sigma);
+		}
+
+		inline T icdf(const T y) const {
+			return normalIcdf(y, mu, sigma);
+		}
+
+		constexpr T mean() const {
+			return mu;
+		}
+
+		constexpr T variance() const {
+			return sigma * sigma;
+		}
+
+		T mu;
+		T sigma;
+	};
+
+	/** @brief	Lognormal distribution kernel with parameters mu and sigma of the underlying normal, evaluated in precision T */
+	template<typename T>
+	struct BasicLognormalKernel : Kernel<BasicLognormalKernel<T> > {
+		using value_type = T;
+
+		using Kernel<BasicLognormalKernel<T> >::pdf;
+		using Kernel<BasicLognormalKernel<T> >::cdf;
+		using Kernel<BasicLognormalKernel<T> >::icdf;
+
+		constexpr BasicLognormalKernel(const T m, const T s) : mu(m), sigma(s) {}
+
+		inline T pdf(const T x) const {
+			return lognormalPdf(x, mu, sigma);
+		}
+
+		inline T cdf(const T x) const {
+			return lognormalCdf(x, mu, sigma);
+		}
+
+		inline T icdf(const T y) const {
+			return lognormalIcdf(y, mu, sigma);
+		}
+
+		inline T mean() const {
+			return std::exp(mu + sigma * sigma / 2);
+		}
+
+		inline T variance() const {
+			return (std::exp(sigma * sigma) - 1) * std::exp(2 * mu + sigma * sigma);
+		}
+
+		T mu;
+		T sigma;
+	};
+
+	using NormalKernel = BasicNormalKernel<double>;
+	using LognormalKernel = BasicLognormalKernel<double>;
+	using NormalKernelF = BasicNormalKernel<float>;
+	using LognormalKernelF = BasicLognormalKernel<float>;
+}
+#endif //RV_KERNELS_H
@@ -0,0 +1,44 @@
+/** Loader Namespace - Header
+ *
+ *	@file 		Loader Namespace
+ *
+ *	@brief 		Loader Namespace - Contains functions for reading large CSV/newline-delimited sample
+ * 				files directly into NonParametric distributions
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_LOADER_H
+#define RV_LOADER_H
+
+#include <string>
+
+namespace Loader {
+	// *------------------------------*
+	// |     	   LOADING            |
+	// *------------------------------*
+
+	/** @brief		Reads a sample file and constructs a nonparametric object from it
+	 *	@details	The file is memory mapped (or read in one pass where mapping is unavailable), split into
+	 *				chunks on line boundaries and each chunk is parsed on its own thread. Every line holds a
+	 *				value, optionally followed by a positive frequency ("value,count"); commas, semicolons, tabs
+	 *				and spaces are accepted as separators and nothing but whitespace may follow. Empty lines,
+	 *				lines starting with '#' and a non-numeric header on the first line are skipped. Rows may
+	 *				come in any order and repeat a value; a Weighted result merges them into one sorted pair.
+	 *
+	 *	@param	path		Path of the file to read
+	 *	@param	nThreads	Number of parsing threads, 0 selects the hardware concurrency
+	 *	@throws		std::runtime_error exception if the file cannot be read
+	 *	@throws		std::invalid_argument exception if a line cannot be parsed
+	 *	@returns 	Instance of S constructed with the values (and frequencies) of the file
+	 *	@example	Unweighted uw = Loader::load<Unweighted>("samples.csv");
+	 */
+	template<typename S>
+	S load(const std::string& path, const unsigned int nThreads = 0);
+}
+#endif //RV_LOADER_H
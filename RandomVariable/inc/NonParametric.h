@@ -37,6 +37,15 @@ public:
 	 */
 	virtual void append(const double d) = 0;
 
+	/** @brief		Appends n values to the member data set
+	 *
+	 *	@remark		The default calls append(d) for each value; subclasses with contiguous storage override
+	 *				it to append the whole range at once
+	 *	@param	n		Number of values
+	 *	@param	values	Array of at least n values
+	 */
+	virtual void append(const size_type n, const double* values);
+
 	/** @brief		Retrieves value in the kth position from the data set 
 	 *
 	 *	@param	k	Position of target value
@@ -17,6 +17,7 @@
 #define RV_PAR_NORMAL_H
 
 #include "Parametric.h"
+#include "Kernels.h"
 
 class Normal: public Parametric {
 public:
@@ -109,7 +110,9 @@ public:
 	 *	@param	x	Input value which subclasses may attach contraints to
 	 *	@returns 	Output(y - value) to pdf function
 	 */
-    double pdf(const double x) const;
+    inline double pdf(const double x) const {
+		return Kernels::normalPdf(x, mu, sigma);
+	}
 
 	/** @brief		Calculates cumulative density function for a normal distribution
 	 *
@@ -118,7 +121,9 @@ public:
 	 *	@param	x	Input value to cdf function that can be any real number
 	 *	@returns 	Output(y - value) to pdf function
 	 */
-	double cdf(const double x) const;
+	inline double cdf(const double x) const {
+		return Kernels::normalCdf(x, mu, sigma);
+	}
 
 	/** @brief		Calculates inverse cumulative density function for a normal distribution
 	 *
@@ -132,6 +137,22 @@ public:
 	 */
     double icdf(const double y) const;
 
+	/** @brief		Evaluates cdf() at n inputs with the normal kernel
+	 *
+	 *	@param	n	Number of values in x and out
+	 *	@param	x	Inputs to the cdf
+	 *	@param	out	Buffer with room for at least n doubles, may alias x
+	 */
+	void cdf(const unsigned int n, const double* x, double* out) const;
+
+	/** @brief		Evaluates the natural log of pdf() at n inputs with the normal kernel
+	 *
+	 *	@param	n	Number of values in x and out
+	 *	@param	x	Inputs to the pdf
+	 *	@param	out	Buffer with room for at least n doubles, may alias x
+	 */
+	void logPdf(const unsigned int n, const double* x, double* out) const;
+
 	/**
 	 *	@param	U	Target cumulative distribution value
 	 *	@brief		Calculates input value corresponding to CDF value of U
@@ -178,12 +199,33 @@ public:
 	// |          SAMPLING            |
 	// *------------------------------*
 
+	using RandomVariable::sample;
+
 	/** @brief 		Sample of multiple values from distribution not using icdf()
 	 *
-	 *	@param	n	Number of samples to return within the vector
-	 *	@returns 	A std::vector<double> of sample values
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Sample of multiple values from distribution in single precision
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n floats
+	 */
+	void sample(const unsigned int n, float* out) const;
+
+	using Parametric::sampleIcdf;
+
+	/** @brief 		Sample of multiple values from distribution using the single precision icdf() kernel
+	 *
+	 *	@param	n	Number of values in y and out
+	 *	@param	y	Inputs for icdf(), each in [0,1]; 0 and 1 are moved to the closest representable
+	 *				probabilities so they do not return -Inf and Inf
+	 *	@param	out	Buffer with room for at least n floats, may alias y
+	 *	@throws		std::invalid_argument exception if any input is outside of [0,1]
 	 */
-	vector_type sample(const unsigned int n) const;
+	void sampleIcdf(const unsigned int n, const float* y, float* out) const;
 
 private:
 	double mu;
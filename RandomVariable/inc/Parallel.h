@@ -0,0 +1,105 @@
+/** Parallel Namespace - Header
+ *
+ *	@file 		Parallel Namespace
+ *
+ *	@brief 		Parallel Namespace - Small helpers for splitting work across std::thread workers
+ *				used by the loaders and batch operations of the library
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_PARALLEL_H
+#define RV_PARALLEL_H
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "Trace.h"
+
+namespace Parallel {
+	// *------------------------------*
+	// |     	   THREADING          |
+	// *------------------------------*
+
+	/** @brief		Resolves the number of worker threads to use
+	 *
+	 *	@param	requested	Requested number of threads, 0 selects the hardware concurrency
+	 *	@returns 	Number of threads (always > 0)
+	 */
+	inline unsigned int threads(const unsigned int requested) {
+		if (requested > 0) {
+			return requested;
+		}
+		const unsigned int hw = std::thread::hardware_concurrency();
+		return hw > 0 ? hw : 1;
+	}
+
+	/** @brief		Runs f(i) for every i in [0, nTasks), one thread per task
+	 *
+	 *	@remark		The calling thread runs the last task so a single task never spawns a thread or allocates
+	 *	@remark		The first exception thrown by a task is rethrown after all tasks are joined
+	 *	@param	nTasks	Number of tasks
+	 *	@param	f		Callable taking the task index
+	 */
+	template<typename F>
+	void run(const unsigned int nTasks, F f) {
+		if (nTasks == 0) {
+			return;
+		}
+		// A single task runs inline without the bookkeeping below, so it does not allocate
+		if (nTasks == 1) {
+			f(0);
+			return;
+		}
+		std::vector<std::exception_ptr> errors(nTasks);
+		const auto task = [&](const unsigned int i) {
+			RV_TRACE_SPAN("Parallel::task");
+			try {
+				f(i);
+			} catch (...) {
+				errors[i] = std::current_exception();
+			}
+		};
+		std::vector<std::thread> workers;
+		workers.reserve(nTasks - 1);
+		for (unsigned int i = 0; i + 1 < nTasks; i++) {
+			workers.emplace_back(task, i);
+		}
+		task(nTasks - 1);
+		for (std::thread& t : workers) {
+			t.join();
+		}
+		for (const std::exception_ptr& e : errors) {
+			if (e) {
+				std::rethrow_exception(e);
+			}
+		}
+	}
+
+	/** @brief		Splits [0, n) into contiguous chunks and runs f(chunk, begin, end) on each
+	 *
+	 *	@param	n			Number of elements
+	 *	@param	nThreads	Requested number of threads, 0 selects the hardware concurrency
+	 *	@param	f			Callable taking the chunk index and the [begin, end) element range
+	 *	@returns 	Number of chunks that were run
+	 */
+	template<typename F>
+	unsigned int forChunks(const std::size_t n, const unsigned int nThreads, F f) {
+		std::size_t nChunks = threads(nThreads);
+		if (nChunks > n) {
+			nChunks = n > 0 ? n : 1;
+		}
+		run(static_cast<unsigned int>(nChunks), [&](const unsigned int i) {
+			f(i, n * i / nChunks, n * (i + 1) / nChunks);
+		});
+		return static_cast<unsigned int>(nChunks);
+	}
+}
+#endif //RV_PARALLEL_H
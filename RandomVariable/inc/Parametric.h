@@ -59,6 +59,25 @@ public:
 	 */
     virtual double icdf(const double y) const = 0;
 
+	/** @brief		Evaluates cdf() at n inputs
+	 *
+	 *	@remark		The default calls cdf(x) for each input; subclasses override it with a kernel loop
+	 *	@param	n	Number of values in x and out
+	 *	@param	x	Inputs to the cdf
+	 *	@param	out	Buffer with room for at least n doubles, may alias x
+	 */
+	virtual void cdf(const unsigned int n, const double* x, double* out) const;
+
+	/** @brief		Evaluates the natural log of pdf() at n inputs
+	 *
+	 *	@remark		Summing logs does not underflow in the tails like a product of densities, so this is
+	 *				what likelihoods are built from. The default calls log(pdf(x)) for each input
+	 *	@param	n	Number of values in x and out
+	 *	@param	x	Inputs to the pdf; an input outside the support gives -Inf
+	 *	@param	out	Buffer with room for at least n doubles, may alias x
+	 */
+	virtual void logPdf(const unsigned int n, const double* x, double* out) const;
+
 	// *------------------------------* 
 	// |     	  ACCESSORS           |
 	// *------------------------------*
@@ -94,6 +113,23 @@ public:
 	 *	@returns 	A std::vector<double> of sample output values from icdf()
 	 */
 	vector_type sampleIcdf(const unsigned int n, const vector_type& v) const;
+
+	/** @brief 		Sample of multiple values from distribution using icdf() written into a caller-provided buffer
+	 *
+	 *	@param	n	Number of values in y and out
+	 *	@param	y	Inputs for icdf(), each in [0,1]
+	 *	@param	out	Buffer with room for at least n doubles, may alias y
+	 */
+	void sampleIcdf(const unsigned int n, const double* y, double* out) const;
+
+	/** @brief 		Sample of multiple values from distribution using icdf() in single precision
+	 *
+	 *	@remark		The default evaluates icdf() in double and narrows; subclasses override it with float kernels
+	 *	@param	n	Number of values in y and out
+	 *	@param	y	Inputs for icdf(), each in [0,1]
+	 *	@param	out	Buffer with room for at least n floats, may alias y
+	 */
+	virtual void sampleIcdf(const unsigned int n, const float* y, float* out) const;
 };
 
 #endif //RV_PARAMETRIC_H
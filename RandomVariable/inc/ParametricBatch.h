@@ -0,0 +1,171 @@
+/** ParametricBatch Object - Header
+ *
+ *	@file 		Parametric Distribution Batch Class
+ *
+ *	@brief 		ParametricBatch Class - Structure-of-arrays container of many parametric distributions of
+ *				the same type. Parameters are stored as contiguous arrays (mus[], sigmas[]) and pdf/cdf/icdf/sample
+ *				are evaluated across the whole batch with the inline kernels, split into chunks across threads
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_PARAMETRICBATCH_H
+#define RV_PARAMETRICBATCH_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Kernels.h"
+
+/** @brief		Batch of distributions described by kernel K (e.g. Kernels::NormalKernel)
+ *
+ *	@example	NormalBatch batch(mus, sigmas);
+ *				std::vector<double> p(batch.getSize());
+ *				batch.cdf(threshold, p.data()); // P(X_i <= threshold) for every distribution
+ */
+template<typename K>
+class ParametricBatch {
+public:
+	using kernel_type = K;
+	using value_type = typename K::value_type;
+	using size_type = std::size_t;
+	using vector_type = std::vector<value_type>;
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/**	@brief		Default constructor creating an empty batch */
+	ParametricBatch();
+
+	/** @brief		Value constructor taking the parameters of every distribution
+	 *
+	 *	@param	mus		Mu parameter of each distribution
+	 *	@param	sigmas	Sigma parameter of each distribution
+	 *	@throws		std::invalid_argument exception if the sizes differ or a sigma is 0 or negative
+	 */
+	ParametricBatch(vector_type mus, vector_type sigmas);
+
+	/** @brief		Value constructor creating n identical distributions
+	 *
+	 *	@param	n		Number of distributions
+	 *	@param	mu		Mu parameter of every distribution
+	 *	@param	sigma	Sigma parameter of every distribution
+	 *	@throws		std::invalid_argument exception if sigma is 0 or negative
+	 */
+	ParametricBatch(const size_type n, const value_type mu, const value_type sigma);
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves number of distributions in the batch
+	 *
+	 *	@returns	Number of distributions
+	 */
+	inline size_type getSize() const {
+		return mus.size();
+	}
+
+	/** @brief		Retrieves the parameter arrays of the batch
+	 *
+	 *	@returns	Contiguous array of the mu (or sigma) parameters
+	 */
+	inline const vector_type& getMus() const {
+		return mus;
+	}
+
+	inline const vector_type& getSigmas() const {
+		return sigmas;
+	}
+
+	/** @brief		Retrieves the kernel of the kth distribution
+	 *
+	 *	@param	k	Zero-indexed position of the distribution
+	 *	@throws		std::out_of_range exception
+	 *	@returns	Kernel with the parameters of the kth distribution
+	 */
+	K getKernel(const size_type k) const;
+
+	/** @brief		Assigns the parameters of the kth distribution
+	 *
+	 *	@param	k		Zero-indexed position of the distribution
+	 *	@param	mu		New mu value
+	 *	@param	sigma	New sigma value
+	 *	@throws		std::invalid_argument exception if sigma is 0 or negative
+	 *	@throws		std::out_of_range exception
+	 */
+	void set(const size_type k, const value_type mu, const value_type sigma);
+
+	/** @brief		Appends a distribution to the batch
+	 *
+	 *	@param	mu		Mu parameter
+	 *	@param	sigma	Sigma parameter
+	 *	@throws		std::invalid_argument exception if sigma is 0 or negative
+	 */
+	void append(const value_type mu, const value_type sigma);
+
+	// *------------------------------*
+	// |     	 CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Evaluates pdf, cdf or icdf of every distribution at its own input
+	 *
+	 *	@param	in			Input for each distribution (getSize() values); icdf inputs must be in (0,1)
+	 *	@param	out			Buffer with room for getSize() values, may alias in
+	 *	@param	nThreads	Number of threads, 0 selects the hardware concurrency
+	 */
+	void pdf(const value_type* in, value_type* out, const unsigned int nThreads = 0) const;
+	void cdf(const value_type* in, value_type* out, const unsigned int nThreads = 0) const;
+	void icdf(const value_type* in, value_type* out, const unsigned int nThreads = 0) const;
+
+	/** @brief		Evaluates pdf, cdf or icdf of every distribution at the same input
+	 *
+	 *	@param	x			Input shared by all distributions; an icdf input must be in (0,1)
+	 *	@param	out			Buffer with room for getSize() values
+	 *	@param	nThreads	Number of threads, 0 selects the hardware concurrency
+	 */
+	void pdf(const value_type x, value_type* out, const unsigned int nThreads = 0) const;
+	void cdf(const value_type x, value_type* out, const unsigned int nThreads = 0) const;
+	void icdf(const value_type y, value_type* out, const unsigned int nThreads = 0) const;
+
+	// *------------------------------*
+	// |          SAMPLING            |
+	// *------------------------------*
+
+	/** @brief 		Draws one sample from every distribution by inverse transform sampling
+	 *
+	 *	@remark		Each chunk uses its own generator seeded from seed and the chunk index, so results
+	 *				are reproducible for a given seed and thread count
+	 *	@param	out			Buffer with room for getSize() values
+	 *	@param	seed		Seed of the random number generators
+	 *	@param	nThreads	Number of threads, 0 selects the hardware concurrency
+	 */
+	void sample(value_type* out, const unsigned int seed, const unsigned int nThreads = 0) const;
+
+private:
+	/** @brief	Runs f(begin, end) over chunks of the batch, in parallel for large batches */
+	template<typename F>
+	void forChunks(const unsigned int nThreads, F f) const;
+
+	vector_type mus;
+	vector_type sigmas;
+};
+
+// Member functions are defined and instantiated for the library kernels in ParametricBatch.cpp
+extern template class ParametricBatch<Kernels::NormalKernel>;
+extern template class ParametricBatch<Kernels::NormalKernelF>;
+extern template class ParametricBatch<Kernels::LognormalKernel>;
+extern template class ParametricBatch<Kernels::LognormalKernelF>;
+
+using NormalBatch = ParametricBatch<Kernels::NormalKernel>;
+using NormalBatchF = ParametricBatch<Kernels::NormalKernelF>;
+using LognormalBatch = ParametricBatch<Kernels::LognormalKernel>;
+using LognormalBatchF = ParametricBatch<Kernels::LognormalKernelF>;
+
+#endif //RV_PARAMETRICBATCH_H
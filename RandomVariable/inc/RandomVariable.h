@@ -18,6 +18,8 @@
 
 #include <vector>
 #include <limits>
+#include <cstddef>
+#include <utility>
 
 /** @struct Statistics
  *	@brief 	An object that allows for easy instantiation of distributions
@@ -110,14 +112,45 @@ public:
 	 */
 	virtual double sampleSingle() const = 0;
 
-	/** @brief 		Sample of multiple values from dd`istribution not using icdf()
+	/** @brief 		Sample of multiple values from distribution not using icdf()
 	 *
-	 *	@remark		This function is not const because in the curren version one subclass uses
-	 *				and increments a static variable
+	 *	@remark		Calls the buffer overload, so subclasses only implement that one
 	 *	@param	n	Number of samples to return within the vector
 	 *	@returns 	A std::vector<double> of sample values
 	 */
-	virtual vector_type sample(const unsigned int n) const = 0;
+	vector_type sample(const unsigned int n) const;
+
+	/** @brief 		Sample of multiple values from distribution written into a caller-provided buffer
+	 *
+	 *	@remark		Does not allocate, so the buffer can come from an Arena or be reused across calls
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	virtual void sample(const unsigned int n, double* out) const = 0;
+
+	/** @brief 		Sample of multiple values from distribution in single precision
+	 *
+	 *	@remark		The default generates doubles through a small stack buffer and narrows them;
+	 *				subclasses override it to sample in float directly
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n floats
+	 */
+	virtual void sample(const unsigned int n, float* out) const;
+
+	/** @brief 		Sample of multiple values from distribution into a vector using a custom allocator
+	 *
+	 *	@param	n		Number of samples to return within the vector
+	 *	@param	alloc	Allocator used for the returned vector (e.g. ArenaAllocator<double> or ArenaAllocator<float>)
+	 *	@returns 	A std::vector<double, A> (or std::vector<float, A>) of sample values
+	 *	@example	Arena arena;
+	 *				auto samples = normal.sample(1000, ArenaAllocator<double>(arena));
+	 */
+	template<typename A>
+	std::vector<typename A::value_type, A> sample(const unsigned int n, const A& alloc) const {
+		std::vector<typename A::value_type, A> samples(n, typename A::value_type(), alloc);
+		sample(n, samples.data());
+		return samples;
+	}
 
 	/** @brief 		Sample of multiple values from distribution using icdf()
 	 *
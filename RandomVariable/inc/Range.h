@@ -0,0 +1,58 @@
+/** Range Object - Header
+ *
+ *	@file 		Iterator Range Class
+ *
+ *	@brief 		Range Class - Read-only view of a sequence given by a pair of iterators. Data sets return ranges
+ *				over their storage so callers can scan values without copying them
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_RANGE_H
+#define RV_RANGE_H
+
+#include <cstddef>
+#include <iterator>
+
+/** @brief		Pair of iterators usable in range-based for loops and standard algorithms
+ *
+ *	@remark		A range is invalidated by anything that invalidates its iterators (e.g. an append)
+ *	@example	for (const double x : uw.values()) { ... }
+ *				std::accumulate(w.values().begin(), w.values().end(), 0.0);
+ */
+template<typename It>
+class Range {
+public:
+	using iterator = It;
+	using value_type = typename std::iterator_traits<It>::value_type;
+	using size_type = std::size_t;
+
+	constexpr Range(const It iFirst, const It iLast) : first(iFirst), last(iLast) {}
+
+	constexpr It begin() const {
+		return first;
+	}
+
+	constexpr It end() const {
+		return last;
+	}
+
+	constexpr bool empty() const {
+		return !(first != last);
+	}
+
+	/** @brief		Number of elements, linear in the length for iterators that are not random access	*/
+	inline size_type size() const {
+		return static_cast<size_type>(std::distance(first, last));
+	}
+
+private:
+	It first;
+	It last;
+};
+#endif //RV_RANGE_H
@@ -0,0 +1,194 @@
+/** Reservoir Object - Header
+ *
+ *	@file 		Reservoir Sample Class
+ *
+ *	@brief 		Reservoir Sample Class - Bounded random subsample of an unbounded stream. At most getCapacity()
+ *				values are kept, appends are O(1) amortised, and reservoirs filled on different threads can be
+ *				merged into a subsample of the combined stream
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_NPAR_RESERVOIR_H
+#define RV_NPAR_RESERVOIR_H
+
+#include <random>
+
+#include "NonParametric.h"
+
+/** @brief		Weighted reservoir sample (Efraimidis-Spirakis keys with exponential jumps)
+ *
+ *	@remark		Every value gets a key u^(1/w) and the values with the largest keys are kept. Once full the
+ *				weight to skip before the next replacement is drawn in one step, so unit-weight appends cost
+ *				a subtraction and random numbers are only drawn on replacement, as in Algorithm L. Keys are
+ *				comparable between reservoirs, which makes merge() exact
+ *	@example	Reservoir r(1000);
+ *				for (double x : stream) { r.append(x); } // r holds a uniform subsample of 1000 values
+ */
+class Reservoir: public NonParametric {
+public:
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Constructs an empty reservoir seeded from std::random_device
+	 *
+	 *	@param	capacity	Maximum number of values kept
+	 *	@throws		std::invalid_argument exception if capacity is 0
+	 */
+	explicit Reservoir(const size_type capacity);
+
+	/** @brief		Constructs an empty reservoir with a reproducible seed
+	 *
+	 *	@remark		Reservoirs that are merged must use different seeds
+	 *	@param	capacity	Maximum number of values kept
+	 *	@param	seed		Seed of the random number generator
+	 *	@throws		std::invalid_argument exception if capacity is 0
+	 */
+	Reservoir(const size_type capacity, const unsigned int seed);
+
+	/**	@brief	Reservoir destructor if destructor is called on a RandomVariable pointer */
+	~Reservoir();
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves number of values kept	*/
+	inline size_type getSize() const {
+		return entries.size();
+	}
+
+	/** @brief		Retrieves maximum number of values kept	*/
+	inline size_type getCapacity() const {
+		return capacity;
+	}
+
+	/** @brief		Retrieves number of values appended, including merged reservoirs	*/
+	inline size_type getCount() const {
+		return count;
+	}
+
+	/** @brief		Retrieves total weight of the values appended, including merged reservoirs	*/
+	inline double getTotalWeight() const {
+		return totalWeight;
+	}
+
+	/** @brief		Appends a value with weight 1
+	 *
+	 *	@param	d	Any real number
+	 */
+	void append(const double d);
+
+	/** @brief		Appends a value whose probability of being kept is proportional to its weight
+	 *
+	 *	@param	d	Any real number
+	 *	@param	w	Weight of the value
+	 *	@throws		std::invalid_argument exception if w is not positive
+	 */
+	void append(const double d, const double w);
+
+	/** @brief		Appends a value - frequency pair of a Weighted set as one value weighted by its frequency
+	 *
+	 *	@param	p	f_pair object to append
+	 *	@throws		std::invalid_argument exception if the frequency is 0
+	 */
+	void append(const f_pair p);
+
+	/** @brief		Merges another reservoir so this one holds a subsample of both streams
+	 *
+	 *	@param	other	Reservoir filled with a different seed, e.g. on another thread
+	 *	@throws		std::invalid_argument exception if other is this reservoir
+	 */
+	void merge(const Reservoir& other);
+
+	/** @brief		Retrieves the kth kept value; kept values are in no particular order
+	 *
+	 *	@param	k	Zero-indexed position of target value
+	 *	@throws		std::out_of_range exception
+	 */
+	double get(const size_type k) const;
+
+	/** @brief		Returns the kept values as a vector of doubles	*/
+	vector_type getData() const;
+
+	/** @brief		Returns the kept values as a vector of value - frequency pairs	*/
+	pvector_type getWData() const;
+
+	/** @brief		Removes all values */
+	void clear();
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Mean, median, sample standard deviation and mode of the kept values */
+	double mean() const;
+	double median() const;
+	double std() const;
+	double mode() const;
+
+	/** @brief		Calculates mean value frequency within the kept values	*/
+	double meanHeight() const;
+
+	// *------------------------------*
+	// |          SAMPLING            |
+	// *------------------------------*
+
+	/** @brief 		Resamples a single kept value uniformly	*/
+	double sampleSingle() const;
+
+	using RandomVariable::sample;
+
+	/** @brief 		Resamples multiple kept values uniformly with replacement
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Empirical quantile of the kept values (order statistic at rank y * (N - 1))
+	 *
+	 *	@param	y	Cumulative probability in [0,1]
+	 *	@throws		std::invalid_argument exception if y is outside [0,1] or the reservoir is empty
+	 */
+	double sampleSingleIcdf(const double y) const;
+
+	/** @brief 		Empirical quantiles of the kept values for each probability in v
+	 *
+	 *	@throws		std::invalid_argument exception if n differs from the size of v
+	 */
+	vector_type sampleIcdf(const unsigned int n, const vector_type& v) const;
+
+	// *------------------------------*
+	// |           VISUAL             |
+	// *------------------------------*
+
+	/** @brief		Prints the kept values for testing purposes */
+	void printData() const;
+
+private:
+	using entry_type = std::pair<double, double>;	// log key, value
+
+	/** @brief		Uniform random number in (0,1)	*/
+	double uniform();
+
+	/** @brief		Draws the weight to skip before the next replacement of the smallest key */
+	void drawJump();
+
+	/** @brief		Keeps a value with a given log key if it is among the largest keys */
+	void offer(const entry_type& e);
+
+	size_type capacity;
+	size_type count;
+	double totalWeight;
+	double jump;						// weight left to skip before the next replacement
+	std::vector<entry_type> entries;	// min-heap on the log key
+	std::mt19937_64 gen;
+};
+#endif //RV_NPAR_RESERVOIR_H
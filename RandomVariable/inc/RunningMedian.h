@@ -0,0 +1,89 @@
+/** RunningMedian Object - Header
+ *
+ *	@file 		Running Median Class
+ *
+ *	@brief 		RunningMedian Class - Ordered multiset of values split into a lower and an upper half, so
+ *				the median, minimum and maximum are available in O(1) while values are inserted and
+ *				removed in O(log n)
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_RUNNINGMEDIAN_H
+#define RV_RUNNINGMEDIAN_H
+
+#include <cstddef>
+#include <set>
+
+class RunningMedian {
+public:
+	using size_type = std::size_t;
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves number of values	*/
+	inline size_type getSize() const {
+		return low.size() + high.size();
+	}
+
+	/** @brief		Inserts a value
+	 *
+	 *	@param	x	Value to insert
+	 */
+	void insert(const double x);
+
+	/** @brief		Removes one occurrence of a value
+	 *
+	 *	@param	x	Value to remove
+	 *	@throws		std::invalid_argument exception if x is not present
+	 */
+	void erase(const double x);
+
+	/** @brief		Removes all values */
+	void clear();
+
+	/** @brief		Retrieves the kth smallest value in O(k)
+	 *
+	 *	@param	k	Zero-indexed rank
+	 *	@throws		std::out_of_range exception
+	 */
+	double at(const size_type k) const;
+
+	/** @brief		Calls f on every value in ascending order */
+	template<typename F>
+	void forEach(F f) const {
+		for (const double x : low) {
+			f(x);
+		}
+		for (const double x : high) {
+			f(x);
+		}
+	}
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Median, smallest and largest value
+	 *
+	 *	@throws		std::invalid_argument exception if there are no values
+	 */
+	double median() const;
+	double min() const;
+	double max() const;
+
+private:
+	/** @brief		Restores low.size() == high.size() or low.size() == high.size() + 1 */
+	void rebalance();
+
+	std::multiset<double> low;
+	std::multiset<double> high;
+};
+#endif //RV_RUNNINGMEDIAN_H
@@ -0,0 +1,47 @@
+/** Sort Namespace - Header
+ *
+ *	@file 		Sort Namespace
+ *
+ *	@brief 		Sort Namespace - Parallel least-significant-digit radix sort of doubles on their IEEE bit
+ *				pattern, used to build Weighted sample sets from large vectors
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_SORT_H
+#define RV_SORT_H
+
+#include <cstddef>
+
+namespace Sort {
+	/**	@brief	Inputs smaller than this are sorted with std::sort */
+	constexpr std::size_t RADIX_MIN = 1 << 16;
+
+	/**	@brief	Minimum number of values per thread of the radix sort */
+	constexpr std::size_t MIN_CHUNK = 1 << 18;
+
+	/** @brief		Sorts doubles in ascending order
+	 *
+	 *	@remark		Large inputs use an 8-pass radix sort on the order-preserving bit pattern of the values
+	 *				(Kernels::toOrderedBits) with a thread per chunk; passes whose byte is equal for every value
+	 *				are skipped. Needs 2 * n * 8 bytes of scratch memory. -0 sorts before +0
+	 *	@pre		No value is NaN
+	 *	@param	v			Array of n values, sorted in place
+	 *	@param	n			Number of values
+	 *	@param	nThreads	Number of threads, 0 selects the hardware concurrency
+	 */
+	void sort(double* v, const std::size_t n, const unsigned int nThreads = 0);
+
+	/** @brief		Number of threads worth using on n values: 1 below 2 * MIN_CHUNK, then up to nThreads
+	 *
+	 *	@param	n			Number of values
+	 *	@param	nThreads	Requested number of threads, 0 selects the hardware concurrency
+	 */
+	unsigned int threadsFor(const std::size_t n, const unsigned int nThreads = 0);
+}
+#endif //RV_SORT_H
@@ -0,0 +1,118 @@
+/** SufficientStats Object - Header
+ *
+ *	@file 		Sufficient Statistics Class
+ *
+ *	@brief 		Sufficient Statistics Class - Count, sum and sum of squares of a data set and of its logarithm,
+ *				gathered in one pass and updated in O(1) per value, from which Translation::fitMLE fits
+ *				Normal and Lognormal distributions
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_SUFFICIENT_STATS_H
+#define RV_SUFFICIENT_STATS_H
+
+#include "NonParametric.h"
+
+/** @brief		Sufficient statistics of the Normal and Lognormal families
+ *
+ *	@remark		Sums are kept relative to the first value added (and its logarithm), so the variance does not
+ *				lose precision to cancellation when the mean is large compared to the spread
+ *	@remark		Logarithms are only summed for positive values; getNonPositive() counts the others
+ *	@example	SufficientStats s(uw);
+ *				uw.append(x); s.add(x);
+ *				Normal n = Translation::fitMLE<Normal>(s); // O(1) refit
+ */
+class SufficientStats {
+public:
+	using size_type = RandomVariable::size_type;
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Constructs statistics of an empty data set	*/
+	SufficientStats();
+
+	/** @brief		Gathers the statistics of a data set in one pass
+	 *
+	 *	@remark		Unweighted data is read in place and Weighted data one value - frequency pair at a time;
+	 *				other data sets are read through getData()
+	 *	@param	np	Any nonparametric data set
+	 */
+	explicit SufficientStats(const NonParametric& np);
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Adds a value with a frequency
+	 *
+	 *	@param	x	Any real number
+	 *	@param	w	Frequency of x, not negative
+	 */
+	void add(const double x, const double w = 1);
+
+	/** @brief		Adds the statistics of another data set, giving those of the union	*/
+	void merge(const SufficientStats& other);
+
+	/** @brief		Retrieves the total frequency of the values added	*/
+	inline double getCount() const {
+		return count;
+	}
+
+	/** @brief		Retrieves the total frequency of the values <= 0, which have no logarithm	*/
+	inline double getNonPositive() const {
+		return nonPositive;
+	}
+
+	/** @brief		Sum and sum of squares of the values	*/
+	double sum() const;
+	double sumSquares() const;
+
+	/** @brief		Sum and sum of squares of the logarithms of the positive values	*/
+	double sumLog() const;
+	double sumLogSquares() const;
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Mean and maximum likelihood (biased) variance of the values
+	 *
+	 *	@throws		std::invalid_argument exception if no values were added
+	 */
+	double mean() const;
+	double variance() const;
+
+	/** @brief		Mean and maximum likelihood (biased) variance of the logarithms of the values
+	 *
+	 *	@throws		std::invalid_argument exception if no values were added or any value is <= 0
+	 */
+	double logMean() const;
+	double logVariance() const;
+
+private:
+	/** @brief		Adds every value of [first, last), where valueOf and weightOf read an element */
+	template<typename It, typename V, typename W>
+	void addAll(It first, const It last, V valueOf, W weightOf);
+
+	/** @brief		Throws if no values were added, or if logs are requested and a value is <= 0	*/
+	void require(const bool logs) const;
+
+	double count;
+	double nonPositive;
+	// Sums of x - shift and log(x) - logShift, and of their squares
+	double shift;
+	double logShift;
+	double s1;
+	double s2;
+	double l1;
+	double l2;
+};
+#endif //RV_SUFFICIENT_STATS_H
@@ -0,0 +1,95 @@
+/** Trace Namespace - Header
+ *
+ *	@file 		Trace Namespace
+ *
+ *	@brief 		Trace Namespace - Scoped timeline spans recorded into per-thread ring buffers and exported as
+ *				Chrome trace-event JSON (chrome://tracing, Perfetto) to see where threads of a parallel run stall
+ *	@note		The library phases (sampling, icdf, statistics, Translation, Weighted construction, loading) are
+ *				traced only when RV_TRACE is defined (CMake option of the same name); otherwise RV_TRACE_SPAN
+ *				expands to nothing. Spans created explicitly by user code are always recorded
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_TRACE_H
+#define RV_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace Trace {
+#ifdef RV_TRACE
+	constexpr bool enabled = true;
+#else
+	constexpr bool enabled = false;
+#endif
+
+	/** @brief		Number of spans kept per thread; older spans are overwritten */
+	constexpr std::size_t CAPACITY = 1 << 14;
+
+	/** @brief		Nanoseconds since the first use of the trace clock */
+	std::uint64_t now();
+
+	/** @brief		Appends a completed span to the calling thread's ring buffer without locking
+	 *
+	 *	@param	name	Span name, must outlive the trace (e.g. a string literal)
+	 *	@param	begin	Start time from now()
+	 *	@param	end		End time from now()
+	 */
+	void record(const char* name, const std::uint64_t begin, const std::uint64_t end);
+
+	/** @brief		Writes the recorded spans of all threads as Chrome trace-event JSON
+	 *
+	 *	@remark		Call it once the traced work has finished; spans recorded while dumping may be torn
+	 */
+	void dump(std::ostream& os);
+
+	/** @brief		Writes the trace to a file
+	 *
+	 *	@returns	true if the file was written
+	 */
+	bool dump(const std::string& path);
+
+	/** @brief		Discards all recorded spans; like dump() it is meant for when no spans are being recorded */
+	void clear();
+
+	/** @brief		Records the lifetime of the span as one timeline event of the calling thread
+	 *
+	 *	@example	{
+	 *					Trace::Span span("model batch");
+	 *					...
+	 *				}
+	 *				Trace::dump("trace.json");
+	 */
+	class Span {
+	public:
+		inline explicit Span(const char* n) : name(n), begin(now()) {}
+
+		inline ~Span() {
+			record(name, begin, now());
+		}
+
+		Span(const Span&) = delete;
+		Span& operator=(const Span&) = delete;
+
+	private:
+		const char* const name;
+		const std::uint64_t begin;
+	};
+}
+
+/**	@brief	Traces the rest of the enclosing scope as a span called name when RV_TRACE is defined */
+#ifdef RV_TRACE
+#define RV_TRACE_SPAN(name) const Trace::Span rvTraceSpan(name)
+#else
+#define RV_TRACE_SPAN(name) static_cast<void>(0)
+#endif
+
+#endif //RV_TRACE_H
@@ -16,10 +16,27 @@
 #ifndef RV_TRANSLATION_H
 #define RV_TRANSLATION_H
 
+#include <cstddef>
+#include <vector>
+
 #include "Parametric.h"
 #include "NonParametric.h"
+#include "SufficientStats.h"
 
 namespace Translation {
+	/** @struct GoodnessOfFit
+	 *	@brief 	How well one candidate distribution describes a data set
+	 */
+	struct GoodnessOfFit {
+		std::size_t candidate;	// Index of the distribution in the candidates passed to compare()
+		double ks;				// Kolmogorov-Smirnov statistic, the largest gap between the cdf and the empirical cdf
+		double andersonDarling;	// Anderson-Darling statistic, a squared cdf gap weighted towards the tails
+		double logLikelihood;	// Sum of the log densities of the data
+		double aic;				// Akaike information criterion, 2k - 2 logLikelihood for k parameters
+		double bic;				// Bayesian information criterion, k ln(n) - 2 logLikelihood
+		double rSquared;		// Coefficient of determination of the probability-probability plot
+	};
+
 	// *------------------------------* 
 	// |     	TRANSLATION           |
 	// *------------------------------*
@@ -35,10 +52,65 @@ namespace Translation {
 
 	/** @brief		Fits a nonparametric distribution to parametric distribution	
 	 *
+	 *	@remark		Method of moments from the mean and standard deviation of np
 	 *	@param	np	Pointer to a nonparametric distribution
 	 *	@returns 	Instance of D fitted from a nonparametric distribution 
 	 */
 	template<typename D>
 	D fit(const NonParametric* np);
+
+	/** @brief		Fits a parametric distribution by maximum likelihood
+	 *
+	 *	@remark		Normal takes the mean and biased standard deviation of the values, Lognormal those of
+	 *				their logarithms; both are read from one pass over np
+	 *	@param	np	Pointer to a nonparametric distribution
+	 *	@throws		std::invalid_argument exception if np is empty, or for Lognormal if a value is <= 0
+	 *	@returns 	Instance of D fitted from a nonparametric distribution
+	 */
+	template<typename D>
+	D fitMLE(const NonParametric* np);
+
+	/** @brief		Fits a parametric distribution by maximum likelihood from sufficient statistics in O(1)
+	 *
+	 *	@param	s	Sufficient statistics of the data set, kept up to date with SufficientStats::add()
+	 *	@throws		std::invalid_argument exception if s is empty, or for Lognormal if a value is <= 0
+	 *	@returns 	Instance of D fitted from the statistics
+	 */
+	template<typename D>
+	D fitMLE(const SufficientStats& s);
+
+	// *------------------------------*
+	// |     	 COMPARISON           |
+	// *------------------------------*
+
+	/** @brief		Measures the goodness of fit of several candidate distributions to a data set
+	 *
+	 *	@remark		The data is sorted once and shared; candidates, and chunks of the data for each candidate,
+	 *				are evaluated concurrently with the batched cdf() and logPdf() of the distributions
+	 *	@remark		Statistics that reward a better fit with a smaller value (ks, andersonDarling, aic, bic)
+	 *				and those that reward it with a larger one (logLikelihood, rSquared) are all reported,
+	 *				the ranking uses aic; rSquared is NaN for a single value
+	 *	@example	const Normal n = Translation::fitMLE<Normal>(&uw);
+	 *				const Lognormal l = Translation::fitMLE<Lognormal>(&uw);
+	 *				Translation::compare(&uw, { &n, &l })[0].candidate // 0 if Normal fits better
+	 *	@param	np			Pointer to a nonparametric distribution
+	 *	@param	candidates	Pointers to the fitted parametric distributions
+	 *	@param	nThreads	Requested number of threads, 0 selects the hardware concurrency
+	 *	@throws		std::invalid_argument exception if np is empty or a candidate is null
+	 *	@returns 	One GoodnessOfFit per candidate, best (lowest aic) first
+	 */
+	std::vector<GoodnessOfFit> compare(const NonParametric* np, const std::vector<const Parametric*>& candidates,
+			const unsigned int nThreads = 0);
+
+	/** @brief		Coefficient of determination between the cdf of p and the empirical cdf of np
+	 *
+	 *	@remark		1 - sum (F(x_i) - (i + 0.5) / n)^2 / sum ((i + 0.5) / n - 0.5)^2 over the sorted data x_i,
+	 *				so 1 is a perfect fit
+	 *	@param	np	Pointer to a nonparametric distribution with at least 2 values
+	 *	@param	p	Pointer to a parametric distribution
+	 *	@throws		std::invalid_argument exception if np has fewer than 2 values or p is null
+	 *	@returns 	R squared, at most 1
+	 */
+	double rSquared(const NonParametric* np, const Parametric* p);
 }
 #endif //RV_TRANSLATION_H
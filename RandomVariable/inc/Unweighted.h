@@ -3,7 +3,7 @@
  *	@file 		Unweighted Sample Class
  *    
  *	@brief 		Unweighted Sample Class - Class used for storing and accessing a vector of 
- * 				values(double) representing data with uncertainty
+ * 				values(double, or float for BasicUnweighted<float>) representing data with uncertainty
  * 
  *	@author		Aiden Cullo <aiden.cullo@nasa.gov> 
  *	@date		June 28, 2017 
@@ -16,10 +16,27 @@
 #ifndef RV_NPAR_UNWEIGHTED_H
 #define RV_NPAR_UNWEIGHTED_H
 
-#include "NonParametric.h"
+#include <memory>
 
-class Unweighted: public NonParametric{
+#include "NonParametric.h"
+#include "Range.h"
+#include "Parallel.h"
+#include "RunningMedian.h"
+
+/** @brief		Unweighted sample set storing its values in precision T
+ *
+ *	@remark		The NonParametric interface is in double; a float set (UnweightedF) halves the memory of large
+ *				sample sets and widens values to double only when they are read
+ */
+template<typename T>
+class BasicUnweighted: public NonParametric{
 public: 
+	using value_type = T;
+	using storage_type = std::vector<T>;
+
+	/**	@brief	Minimum number of values per thread of transform() */
+	static constexpr size_type MIN_CHUNK = 1 << 15;
+
 	// *------------------------------* 
 	// |   CONSTRUCTORS/DESTRUCTORS   |
 	// *------------------------------*
@@ -29,17 +46,30 @@ public:
 	 *	@remark		Explicit keyword forbids a vector_type object from being implicitly cast
 	 *	@param	v	A vector of doubles
 	 */
-	explicit Unweighted(const vector_type& v);
+	explicit BasicUnweighted(const vector_type& v);
+
+	/** @brief		Value constructor taking ownership of a vector of values 
+	 *
+	 *	@remark		Avoids copying large sample sets (e.g. from Loader::load())
+	 *	@param	v	A vector of values in precision T
+	 */
+	explicit BasicUnweighted(storage_type&& v);
 
 	/** @brief		Value constructor taking in a vector of value - frequency pairs 
 	 *
 	 *	@remark		Explicit keyword forbids a pvector_type object from being implicitly cast
 	 *	@param	pv	A vector of pairs (std::pair<double, unsigned int>)
 	 */
-	explicit Unweighted(const pvector_type&);
+	explicit BasicUnweighted(const pvector_type&);
+
+	/**	@brief	Copy and move constructors/assignment; moving transfers the data set without copying */
+	BasicUnweighted(const BasicUnweighted& other);
+	BasicUnweighted(BasicUnweighted&&) = default;
+	BasicUnweighted& operator=(const BasicUnweighted& other);
+	BasicUnweighted& operator=(BasicUnweighted&&) = default;
 
 	/**	@brief	Unweighted destructor if destructor is called on a RandomVariable pointer */
-	~Unweighted();
+	~BasicUnweighted();
 
 	// *------------------------------* 
 	// |          ACCESSORS           |
@@ -64,7 +94,15 @@ public:
 	 *	@returns 	The data set as a vector of double
 	 */
 	inline vector_type getData() const {
-		return data;
+		return vector_type(data.cbegin(), data.cend());
+	}
+
+	/** @brief		Read-only view of the values in precision T, without copying
+	 *
+	 *	@example	for (const double x : uw.values()) { ... }
+	 */
+	inline Range<typename storage_type::const_iterator> values() const {
+		return Range<typename storage_type::const_iterator>(data.cbegin(), data.cend());
 	}
 
 	/** @brief		Retrieves value in the kth position from the data set 
@@ -89,12 +127,63 @@ public:
 	 */
 	void set(const size_type k, const double d);
 
+	/** @brief		Replaces every value x of the data set by f(x)
+	 *
+	 *	@remark		The loop runs over the raw storage without bounds checks so the compiler can vectorize it;
+	 *				sets of more than 2 * MIN_CHUNK values are split across threads, so f must be thread-safe
+	 *	@param	f			Callable taking and returning a value (e.g. [](double x){ return 2 * x + 1; })
+	 *	@param	nThreads	Number of threads, 0 selects the hardware concurrency
+	 *	@example	Unweighted uw({ 1, 2, 3 });
+	 *				uw.transform([](double x){ return x * x; }); // uw == {1, 4, 9}
+	 */
+	template<typename F>
+	void transform(F f, const unsigned int nThreads = 0) {
+		T* const p = data.data();
+		const size_type n = data.size();
+		const unsigned int useful = static_cast<unsigned int>(n / MIN_CHUNK > 0 ? n / MIN_CHUNK : 1);
+		const unsigned int requested = Parallel::threads(nThreads);
+		Parallel::forChunks(n, requested < useful ? requested : useful, [&](const unsigned int, const size_type begin, const size_type end) {
+			for (size_type i = begin; i < end; i++) {
+				p[i] = static_cast<T>(f(p[i]));
+			}
+		});
+		if (order) {
+			rebuildMedian();
+		}
+	}
+
+	/** @brief		Retrieves the values at many positions at once
+	 *
+	 *	@param	n		Number of positions
+	 *	@param	indices	Array of n zero-indexed positions
+	 *	@param	out		Buffer with room for at least n doubles
+	 *	@throws		std::out_of_range exception if a position is not in the data set; out is then unchanged
+	 */
+	void gather(const size_type n, const size_type* indices, double* out) const;
+
+	/** @brief		Retrieves the values at many positions at once
+	 *
+	 *	@param	indices	Zero-indexed positions
+	 *	@throws		std::out_of_range exception
+	 *	@returns	Vector of the values, in the order of indices
+	 */
+	vector_type gather(const std::vector<size_type>& indices) const;
+
 	/** @brief		Appends a value to the data set	
 	 *
 	 *	@param	d	double value in set to be appended
 	 */
 	void append(const double d);
 
+	using NonParametric::append;
+
+	/** @brief		Appends n values to the data set in one insertion
+	 *
+	 *	@param	n		Number of values
+	 *	@param	values	Array of at least n values
+	 */
+	void append(const size_type n, const double* values);
+
 	// *------------------------------* 
 	// |         CALCULATIONS         |
 	// *------------------------------*
@@ -107,10 +196,24 @@ public:
 
 	/** @brief		Calculates median of the data set
 	 *
-	 *	@returns 	Calculated median 
+	 *	@remark		O(1) when the median is tracked, otherwise a selection over a copy of the data set in O(n)
+	 *	@returns 	Calculated median (mean of the two middle values for an even size)
 	 */
 	double median() const;
 
+	/** @brief		Enables or disables incremental tracking of the median
+	 *
+	 *	@remark		While enabled, append() and set() update an ordered index in O(log n) and median() is
+	 *				O(1); the index stores every value again. Enabling builds the index in O(n log n)
+	 *	@param	enabled	True to track the median
+	 */
+	void setMedianTracking(const bool enabled);
+
+	/** @brief		Checks if the median is tracked incrementally	*/
+	inline bool isMedianTracked() const {
+		return order != nullptr;
+	}
+
 	/** @brief		Calculates standard deviation of the data set
 	 *
 	 *	@returns 	Calculated standard deviation
@@ -143,12 +246,21 @@ public:
 	 */
 	double sampleSingle() const;
 
+	using RandomVariable::sample;
+
 	/** @brief 		Sample of multiple values from a data set
 	 *
-	 *	@param	n	Number of samples to return within the vector
-	 *	@returns 	A std::vector<double> of sample values
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Sample of multiple values from a data set in single precision
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n floats
 	 */
-	vector_type sample(const unsigned int n) const;
+	void sample(const unsigned int n, float* out) const;
 
 	/** @brief 		Currently identical for sampleSingle()
 	 *	@details	This function is different for Parametric distributions and in 
@@ -182,25 +294,37 @@ public:
 private:
 
 	/** @brief		Return iterator pointing to the first object of the data structure	*/
-	inline vtype_iterator begin() {
+	inline typename storage_type::iterator begin() {
 		return data.begin();
 	}
 
 	/** @brief		Return iterator pointing to the last object of the data structure	*/
-	inline vtype_iterator end() {
+	inline typename storage_type::iterator end() {
 		return data.end();
 	}
 
 	/** @brief		Return const iterator pointing to the first object of the data structure	*/
-	inline const_vtype_iterator cbegin() const {
+	inline typename storage_type::const_iterator cbegin() const {
 		return data.cbegin();
 	}
 
 	/** @brief		Return const iterator pointing to the last object of the data structure	*/
-	inline const_vtype_iterator cend() const {
+	inline typename storage_type::const_iterator cend() const {
 		return data.cend();
 	}
 
-	vector_type data;
+	/** @brief		Rebuilds the ordered index from the data set	*/
+	void rebuildMedian();
+
+	storage_type data;
+	// Ordered copy of the data while tracking, held out of line so untracked sets stay small
+	std::unique_ptr<RunningMedian> order;
 };
+
+// Member functions are defined and instantiated for double and float in Unweighted.cpp
+extern template class BasicUnweighted<double>;
+extern template class BasicUnweighted<float>;
+
+using Unweighted = BasicUnweighted<double>;
+using UnweightedF = BasicUnweighted<float>;
 #endif //RV_NPAR_UNWEIGHTED_H
@@ -0,0 +1,125 @@
+/** Versioned Object - Header
+ *
+ *	@file 		Versioned Data Set Class
+ *
+ *	@brief 		Versioned Class - Holds a NonParametric data set as a sequence of immutable, reference-counted
+ *				versions. Readers take the current version and compute on it while writers build the next
+ *				one; a version is reclaimed when its last reader releases it
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_VERSIONED_H
+#define RV_VERSIONED_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Unweighted.h"
+#include "Weighted.h"
+
+/** @brief		Copy-on-publish container of a data set of type S (e.g. Unweighted or Weighted)
+ *
+ *	@remark		snapshot() is an atomic load of a shared pointer and never waits for a writer. Appended
+ *				values are buffered and become visible together on publish(), which copies the current
+ *				version, so publishing every few thousand values amortises the copy. Writers are serialised
+ *				with each other by a mutex that readers never take
+ *	@example	Versioned<Weighted> live(Weighted(RandomVariable::vector_type{ 0 }));
+ *				live.append(x); live.publish();							// ingest thread
+ *				std::shared_ptr<const Weighted> s = live.snapshot();	// dashboard thread
+ *				s->mean(); s->median();									// consistent, no data race
+ */
+template<typename S>
+class Versioned {
+public:
+	using value_type = S;
+	using size_type = std::size_t;
+	using snapshot_type = std::shared_ptr<const S>;
+
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Constructs version 0 from an initial data set
+	 *
+	 *	@param	initial		Data set of the first version
+	 */
+	explicit Versioned(S initial);
+
+	Versioned(const Versioned&) = delete;
+	Versioned& operator=(const Versioned&) = delete;
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves the current version of the data set
+	 *
+	 *	@remark		The snapshot stays valid and unchanged for as long as it is held
+	 *	@returns	Shared pointer to the immutable data set
+	 */
+	snapshot_type snapshot() const;
+
+	/** @brief		Retrieves the number of the current version, incremented by every publish that changes it	*/
+	size_type getVersion() const;
+
+	/** @brief		Buffers a value for the next publish()
+	 *
+	 *	@param	d	Any real number
+	 */
+	void append(const double d);
+
+	/** @brief		Makes the buffered values visible as a new version
+	 *
+	 *	@returns	Number of the current version
+	 */
+	size_type publish();
+
+	/** @brief		Publishes a new version produced by applying f to a copy of the current one
+	 *
+	 *	@remark		Buffered values are appended to the copy before f is applied. If f throws, the current
+	 *				version and the buffered values are left unchanged
+	 *	@param	f	Callable taking S& (e.g. [](Unweighted& u){ u.set(0, 1); })
+	 *	@returns	Number of the new version
+	 */
+	template<typename F>
+	size_type update(F f) {
+		std::lock_guard<std::mutex> lock(writer);
+		std::shared_ptr<Version> next = copyWithPending();
+		f(next->data);
+		return store(std::move(next));
+	}
+
+private:
+	struct Version {
+		Version(S d, const size_type v) : data(std::move(d)), version(v) {}
+
+		S data;
+		size_type version;
+	};
+
+	/** @brief		Copies the current version and appends the buffered values, which stay buffered until
+	 *				store(); requires the writer lock
+	 */
+	std::shared_ptr<Version> copyWithPending();
+
+	/** @brief		Atomically replaces the current version and clears the buffered values; requires the writer lock */
+	size_type store(std::shared_ptr<Version> next);
+
+	std::shared_ptr<const Version> current;		// accessed only through std::atomic_load/atomic_store
+	std::vector<double> pending;
+	std::mutex writer;
+};
+
+// Member functions are defined and instantiated for the library data sets in Versioned.cpp
+extern template class Versioned<Unweighted>;
+extern template class Versioned<Weighted>;
+
+#endif //RV_VERSIONED_H
@@ -19,9 +19,71 @@
 #include <stdexcept>
 
 #include "NonParametric.h"
+#include "Binning.h"
+#include "Range.h"
 
 class Weighted: public NonParametric {
 public: 
+	/** @brief		Iterator over the values of the data set in pair order, each repeated by its frequency
+	 *
+	 *	@remark		Expands the pairs lazily, so a scan over every value does not allocate
+	 */
+	class const_value_iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = double;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const double*;
+		using reference = const double&;
+
+		const_value_iterator(const const_ptype_iterator it, const const_ptype_iterator end) : pair(it), last(end), repeat(0) {
+			skipEmpty();
+		}
+
+		inline reference operator*() const {
+			return pair->first;
+		}
+
+		inline pointer operator->() const {
+			return &pair->first;
+		}
+
+		inline const_value_iterator& operator++() {
+			if (++repeat >= pair->second) {
+				++pair;
+				repeat = 0;
+				skipEmpty();
+			}
+			return *this;
+		}
+
+		inline const_value_iterator operator++(int) {
+			const_value_iterator previous = *this;
+			++*this;
+			return previous;
+		}
+
+		inline bool operator==(const const_value_iterator& other) const {
+			return pair == other.pair && repeat == other.repeat;
+		}
+
+		inline bool operator!=(const const_value_iterator& other) const {
+			return !(*this == other);
+		}
+
+	private:
+		/** @brief		Moves past pairs whose frequency is 0 */
+		inline void skipEmpty() {
+			while (pair != last && pair->second == 0) {
+				++pair;
+			}
+		}
+
+		const_ptype_iterator pair;
+		const_ptype_iterator last;
+		unsigned int repeat;
+	};
+
 	// *------------------------------* 
 	// |   CONSTRUCTORS/DESTRUCTORS   |
 	// *------------------------------*
@@ -33,16 +95,26 @@ public:
 	 *
 	 *	@remark		Explicit keyword forbids a vector_type object from being implicitly cast
 	 *	@remark		Not const because input vector is sorted	
-	 *	@param	v	A vector of doubles
+	 *	@param	v		A vector of doubles
+	 *	@param	binning	Policy merging close values into one pair, exact by default
 	 */
-	explicit Weighted(vector_type v);
+	explicit Weighted(vector_type v, const Binning& binning = Binning());
 
 	/** @brief		Value constructor taking in a vector of value - frequency pairs 
 	 *
 	 *	@remark		Explicit keyword forbids a pvector_type object from being implicitly cast
-	 *	@param	pv	A vector of pairs (std::pair<double, unsigned int>)
+	 *	@remark		Pairs may come in any order; they are sorted, pairs of equal value are merged and pairs
+	 *				with frequency 0 are dropped
+	 *	@param	pv		A vector of pairs (std::pair<double, unsigned int>)
+	 *	@param	binning	Policy merging close values into one pair, exact by default
 	 */
-	explicit Weighted(const pvector_type& pv);
+	explicit Weighted(const pvector_type& pv, const Binning& binning = Binning());
+
+	/**	@brief	Copy and move constructors/assignment; moving transfers the data set without copying */
+	Weighted(const Weighted&) = default;
+	Weighted(Weighted&&) = default;
+	Weighted& operator=(const Weighted&) = default;
+	Weighted& operator=(Weighted&&) = default;
 
 	/**	@brief	Weighted destructor if destructor is called on a RandomVariable pointer */
 	~Weighted();
@@ -68,6 +140,18 @@ public:
 		return data.size();
 	}
 
+	/** @brief		Retrieves the policy applied to values on construction and append	*/
+	inline const Binning& getBinning() const {
+		return binning;
+	}
+
+	/** @brief		Applies a new binning policy to the data set, merging pairs that fall into the same bin
+	 *
+	 *	@remark		Pairs are sorted by value afterwards
+	 *	@param	b	New policy; later appends use it too
+	 */
+	void rebin(const Binning& b);
+
 	/** @brief		Retrieves frequency of double value in data set or exception if value not in data set
 	 *
 	 *	@param	d	Target value whose frequency is returned
@@ -96,6 +180,23 @@ public:
 	 */
 	vector_type getData() const;
 
+	/** @brief		Read-only view of the value - frequency pairs, without copying
+	 *
+	 *	@example	for (const f_pair& p : w.pairs()) { ... }
+	 */
+	inline Range<const_ptype_iterator> pairs() const {
+		return Range<const_ptype_iterator>(cbegin(), cend());
+	}
+
+	/** @brief		Read-only view of the values, each repeated by its frequency, expanded lazily
+	 *
+	 *	@example	Weighted w({ 1, 2, 2 });
+	 *				std::accumulate(w.values().begin(), w.values().end(), 0.0) == 5; // True
+	 */
+	inline Range<const_value_iterator> values() const {
+		return Range<const_value_iterator>(const_value_iterator(cbegin(), cend()), const_value_iterator(cend(), cend()));
+	}
+
 	/** @brief		Retrieves pair in the kth position of the data set 
 	 *
 	 *	@param	k	Zero-indexed position of target value
@@ -122,12 +223,14 @@ public:
 
 	/** @brief		Assigns value in the kth position to f_pair 
 	 *
+	 *	@remark		A pair whose value changes is moved to keep the pairs sorted, merging with a pair of
+	 *				equal value; a frequency of 0 removes the pair
 	 *	@param	k	Zero-indexed position of target value
 	 *	@param	p	f_pair object to be assigned
 	 *
-	 *	@throws		std::invalid_argument exception
+	 *	@throws		std::out_of_range exception
 	 *	@example	Weighted w({ 1, 1, 1, 1, 1, 2, 2, 2, 2, 2 });
-	 *				w.set(0, std::make_pair(7,2)); // w == {7, 7, 2, 2, 2, 2, 2}
+	 *				w.set(0, std::make_pair(7,2)); // w == {2, 2, 2, 2, 2, 7, 7}
 	 */
 	void set(const size_type k, const f_pair p);
 
@@ -147,7 +250,8 @@ public:
 	 *
 	 *	@param	p	f_pair object to append
 	 *
-	 *	@remark		If the value already exists in the data set, the frequency will add to that pair
+	 *	@remark		If the value (after binning) already exists in the data set, the frequency will add to that pair;
+	 *				otherwise a pair is inserted so the pairs stay sorted by value
 	 *	@example	Weighted w({ 1, 2, 2 });
 	 *				w.append(std::make_pair(3,2)); // w == {1, 2, 2, 3, 3}
 	 */
@@ -159,6 +263,8 @@ public:
 	 */
 	void append(const double d);
 
+	using NonParametric::append;
+
 	// *------------------------------* 
 	// |         CALCULATIONS         |
 	// *------------------------------*
@@ -171,6 +277,9 @@ public:
 
 	/** @brief		Calculates median of the distribution
 	 *
+	 *	@remark		Ranks are counted by frequency, so an even total averages the values of ranks size/2-1
+	 *				and size/2; O(number of pairs)
+	 *	@throws		std::invalid_argument exception if the data set is empty
 	 *	@returns 	Calculated median 
 	 */
 	double median() const;
@@ -208,12 +317,14 @@ public:
 	 */
 	double sampleSingle() const;
 
+	using RandomVariable::sample;
+
 	/** @brief 		Sample of multiple values from a data set
 	 *
-	 *	@param	n	Number of samples to return within the vector
-	 *	@returns 	A std::vector<double> of sample values
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
 	 */
-	vector_type sample(const unsigned int n) const;
+	void sample(const unsigned int n, double* out) const;
 
 	/** @brief 		Currently identical for sampleSingle()
 	 *	@details	This function is different for Parametric distributions and in 
@@ -289,7 +400,16 @@ private:
 	 */
 	ptype_iterator findValPtr(const double d);
 
+	/**	@brief		Sorts the pairs by value, merges pairs of equal value and drops pairs of frequency 0	*/
+	void mergeEqual();
+
+	/**	@brief		Adds a (binned) pair, merging with an equal value or inserting it at its ordered position;
+	 *				O(log(number of pairs)) to find the position
+	 */
+	void insert(const f_pair p);
+
 	pvector_type data;
 	size_type size;
+	Binning binning;
 };
 #endif //RV_NPAR_WEIGHTED_H
@@ -0,0 +1,168 @@
+/** Windowed Object - Header
+ *
+ *	@file 		Sliding Window Sample Class
+ *
+ *	@brief 		Windowed Sample Class - Fixed-capacity data set holding the last N values of a stream in a ring
+ *				buffer. Appending to a full window evicts the oldest value, and mean, variance, min/max and
+ *				median are maintained incrementally instead of being recomputed from the data set
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#ifndef RV_NPAR_WINDOWED_H
+#define RV_NPAR_WINDOWED_H
+
+#include "NonParametric.h"
+#include "RunningMedian.h"
+
+/** @brief		Sliding window over the last getCapacity() values
+ *
+ *	@remark		append() is O(log N) and memory is bounded by the capacity; mean(), variance(), std(),
+ *				median(), min() and max() are O(1)
+ *	@example	Windowed w(3);
+ *				w.append(1); w.append(2); w.append(3); w.append(4); // w == {2, 3, 4}
+ *				w.median() == 3; // True
+ */
+class Windowed: public NonParametric {
+public:
+	// *------------------------------*
+	// |   CONSTRUCTORS/DESTRUCTORS   |
+	// *------------------------------*
+
+	/** @brief		Constructs an empty window
+	 *
+	 *	@param	capacity	Maximum number of values kept
+	 *	@throws		std::invalid_argument exception if capacity is 0
+	 */
+	explicit Windowed(const size_type capacity);
+
+	/** @brief		Constructs a window and appends values in order, keeping the last capacity of them
+	 *
+	 *	@param	capacity	Maximum number of values kept
+	 *	@param	v			Values, oldest first
+	 *	@throws		std::invalid_argument exception if capacity is 0 or a value is NaN
+	 */
+	Windowed(const size_type capacity, const vector_type& v);
+
+	/**	@brief	Windowed destructor if destructor is called on a RandomVariable pointer */
+	~Windowed();
+
+	// *------------------------------*
+	// |          ACCESSORS           |
+	// *------------------------------*
+
+	/** @brief		Retrieves number of values in the window	*/
+	inline size_type getSize() const {
+		return count;
+	}
+
+	/** @brief		Retrieves maximum number of values in the window	*/
+	inline size_type getCapacity() const {
+		return ring.size();
+	}
+
+	/** @brief		Checks if the next append() evicts a value	*/
+	inline bool isFull() const {
+		return count == ring.size();
+	}
+
+	/** @brief		Appends a value, evicting the oldest one if the window is full
+	 *
+	 *	@param	d	Any real number
+	 *	@throws		std::invalid_argument exception if d is NaN; the window is left unchanged
+	 */
+	void append(const double d);
+
+	/** @brief		Retrieves the kth oldest value in the window
+	 *
+	 *	@param	k	Zero-indexed age rank (0 is the oldest value)
+	 *	@throws		std::out_of_range exception
+	 */
+	double get(const size_type k) const;
+
+	/** @brief		Returns the window as a vector of doubles, oldest first	*/
+	vector_type getData() const;
+
+	/** @brief		Returns the window as a vector of value - frequency pairs	*/
+	pvector_type getWData() const;
+
+	/** @brief		Removes all values */
+	void clear();
+
+	// *------------------------------*
+	// |         CALCULATIONS         |
+	// *------------------------------*
+
+	/** @brief		Mean, median, sample standard deviation and sample variance of the window */
+	double mean() const;
+	double median() const;
+	double std() const;
+	double variance() const;
+
+	/** @brief		Smallest and largest value in the window
+	 *
+	 *	@throws		std::invalid_argument exception if the window is empty
+	 */
+	double min() const;
+	double max() const;
+
+	/** @brief		Calculates most frequent value of the window in O(N)	*/
+	double mode() const;
+
+	/** @brief		Calculates mean value frequency within the window	*/
+	double meanHeight() const;
+
+	// *------------------------------*
+	// |          SAMPLING            |
+	// *------------------------------*
+
+	/** @brief 		Resamples a single value of the window uniformly	*/
+	double sampleSingle() const;
+
+	using RandomVariable::sample;
+
+	/** @brief 		Resamples multiple values of the window uniformly with replacement
+	 *
+	 *	@param	n	Number of samples to generate
+	 *	@param	out	Buffer with room for at least n doubles
+	 */
+	void sample(const unsigned int n, double* out) const;
+
+	/** @brief 		Empirical quantile of the window (order statistic at rank y * (N - 1))
+	 *
+	 *	@param	y	Cumulative probability in [0,1]
+	 *	@throws		std::invalid_argument exception if y is outside [0,1] or the window is empty
+	 */
+	double sampleSingleIcdf(const double y) const;
+
+	/** @brief 		Empirical quantiles of the window for each probability in v
+	 *
+	 *	@throws		std::invalid_argument exception if n differs from the size of v
+	 */
+	vector_type sampleIcdf(const unsigned int n, const vector_type& v) const;
+
+	// *------------------------------*
+	// |           VISUAL             |
+	// *------------------------------*
+
+	/** @brief		Prints the window, oldest first, for testing purposes */
+	void printData() const;
+
+private:
+	/** @brief		Recomputes mean and squared deviations exactly to remove drift of the incremental updates */
+	void recompute();
+
+	vector_type ring;
+	size_type head;		// position of the oldest value
+	size_type count;
+	size_type evictions;
+	double runningMean;
+	double squaredDeviations;
+	RunningMedian order;
+};
+#endif //RV_NPAR_WINDOWED_H
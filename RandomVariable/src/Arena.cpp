@@ -0,0 +1,113 @@
+/** Arena Object - Implementation
+ *
+ *	@file 		Arena Memory Resource Class
+ *
+ *	@brief 		Arena Class - Monotonic memory resource handing out aligned blocks from large
+ *				chunks and releasing everything at once
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "Arena.h"
+
+namespace {
+	// Size and alignment of a transparent huge page on x86-64/aarch64 Linux
+	const std::size_t HUGE_PAGE_SIZE = 2 << 20;
+}
+
+const Arena::size_type Arena::DEFAULT_ALIGNMENT;
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Arena::Arena(const size_type cSize, const bool huge) : chunks(), current(0), offset(0), used(0),
+		chunkSize(cSize > 0 ? cSize : 1), capacity(0), hugePages(huge) {}
+
+Arena::~Arena() {
+	for (const Chunk& c : chunks) {
+#ifdef __linux__
+		if (hugePages) {
+			std::free(c.memory);
+			continue;
+		}
+#endif
+		::operator delete(c.memory);
+	}
+}
+
+// *------------------------------*
+// |          ALLOCATION          |
+// *------------------------------*
+
+void* Arena::allocate(const size_type bytes, const size_type alignment) {
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+		throw std::invalid_argument("Arena alignment must be a power of two");
+	}
+	for (;;) {
+		if (!chunks.empty()) {
+			const Chunk& c = chunks[current];
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(c.memory + offset);
+			const size_type padding = (alignment - address % alignment) % alignment;
+			if (offset + padding + bytes <= c.size) {
+				char* block = c.memory + offset + padding;
+				offset += padding + bytes;
+				used += padding + bytes;
+				return block;
+			}
+		}
+		nextChunk(bytes, alignment);
+	}
+}
+
+void Arena::reset() {
+	current = 0;
+	offset = 0;
+	used = 0;
+}
+
+void Arena::nextChunk(const size_type bytes, const size_type alignment) {
+	// Reuse a chunk kept from before the last reset() if it is large enough
+	for (size_type i = chunks.empty() ? 0 : current + 1; i < chunks.size(); i++) {
+		if (chunks[i].size >= bytes + alignment) {
+			current = i;
+			offset = 0;
+			return;
+		}
+	}
+	Chunk c;
+	c.size = bytes + alignment > chunkSize ? bytes + alignment : chunkSize;
+	c.memory = nullptr;
+#ifdef __linux__
+	if (hugePages) {
+		c.size = (c.size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+		void* p = nullptr;
+		if (posix_memalign(&p, HUGE_PAGE_SIZE, c.size) != 0) {
+			throw std::bad_alloc();
+		}
+		madvise(p, c.size, MADV_HUGEPAGE);
+		c.memory = static_cast<char*>(p);
+	}
+#endif
+	if (c.memory == nullptr) {
+		c.memory = static_cast<char*>(::operator new(c.size));
+	}
+	chunks.push_back(c);
+	current = chunks.size() - 1;
+	offset = 0;
+	capacity += c.size;
+}
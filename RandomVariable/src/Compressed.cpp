@@ -0,0 +1,345 @@
+/** Compressed Object - Implementation
+ *
+ *	@file 		Compressed Sample Class
+ *
+ *	@brief 		Compressed Sample Class - Value - frequency set stored as variable-length encoded blocks of
+ *				sorted pairs. Values are delta encoded and frequencies are varints; each block records its
+ *				minimum, maximum and the number of values before it, so reductions decode the blocks as a
+ *				stream and get(k) decodes a single block
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include "Compressed.h"
+#include "Weighted.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+
+constexpr Compressed::size_type Compressed::BLOCK_PAIRS;
+
+namespace {
+	void writeVarint(std::uint64_t x, std::vector<std::uint8_t>& out) {
+		while (x >= 0x80) {
+			out.push_back(static_cast<std::uint8_t>(x | 0x80));
+			x >>= 7;
+		}
+		out.push_back(static_cast<std::uint8_t>(x));
+	}
+
+	/** @brief	Sorts pairs by value and merges pairs of equal value */
+	RandomVariable::pvector_type sortedDistinct(RandomVariable::pvector_type pv) {
+		std::sort(pv.begin(), pv.end());
+		RandomVariable::pvector_type merged;
+		merged.reserve(pv.size());
+		for (const RandomVariable::f_pair& p : pv) {
+			if (!merged.empty() && isDoubleEqual(merged.back().first, p.first)) {
+				merged.back().second += p.second;
+			} else if (p.second > 0) {
+				merged.push_back(p);
+			}
+		}
+		return merged;
+	}
+
+	/** @brief	Checks if a value is exactly an integer multiple of step */
+	bool onGrid(const double x, const double step) {
+		const double k = std::round(x / step);
+		return std::fabs(k) < 9007199254740992.0 && !(k * step < x) && !(k * step > x);
+	}
+}
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Compressed::Compressed(const Weighted& w) : Compressed(w.getWData(), w.getBinning()) {}
+
+Compressed::Compressed(const pvector_type& pv, const Binning& b) : encodedBytes(0), size(0), numPairs(0), binning(b), grid(false) {
+	RV_TRACE_SPAN("Compressed::Compressed");
+	pvector_type binned(pv);
+	if (!binning.isExact()) {
+		for (f_pair& p : binned) {
+			p.first = binning.bin(p.first);
+		}
+	}
+	binned = sortedDistinct(std::move(binned));
+	if (binning.getType() == Binning::Type::ABSOLUTE) {
+		const double step = binning.getStep();
+		grid = std::all_of(binned.cbegin(), binned.cend(), [=](const f_pair& p){ return onGrid(p.first, step); });
+	}
+	encode(binned);
+}
+
+Compressed::~Compressed() {}
+
+// *------------------------------*
+// |           ENCODING           |
+// *------------------------------*
+
+void Compressed::encode(const pvector_type& pv) {
+	for (pvector_type::const_iterator first = pv.cbegin(); first != pv.cend(); ) {
+		const pvector_type::const_iterator last = pv.cend() - first > static_cast<std::ptrdiff_t>(BLOCK_PAIRS)
+				? first + static_cast<std::ptrdiff_t>(BLOCK_PAIRS) : pv.cend();
+		Block b = encodeBlock(first, last);
+		b.countBefore = size;
+		size += b.count;
+		numPairs += b.pairs;
+		encodedBytes += b.bytes.size();
+		blocks.push_back(std::move(b));
+		first = last;
+	}
+}
+
+Compressed::Block Compressed::encodeBlock(pvector_type::const_iterator first, pvector_type::const_iterator last) const {
+	Block b;
+	b.min = first->first;
+	b.max = (last - 1)->first;
+	b.countBefore = 0;
+	b.count = 0;
+	b.pairs = static_cast<size_type>(last - first);
+	std::vector<std::uint8_t>& out = b.bytes;
+	const double step = binning.getStep();
+	std::int64_t prevIndex = grid ? std::llround(b.min / step) : 0;
+	std::uint64_t prevBits = Kernels::toOrderedBits(b.min);
+	for (pvector_type::const_iterator it = first; it != last; ++it) {
+		if (it != first) {
+			if (grid) {
+				const std::int64_t k = std::llround(it->first / step);
+				writeVarint(static_cast<std::uint64_t>(k - prevIndex), out);
+				prevIndex = k;
+			} else {
+				const std::uint64_t bits = Kernels::toOrderedBits(it->first);
+				writeVarint(bits - prevBits, out);
+				prevBits = bits;
+			}
+		}
+		writeVarint(it->second, out);
+		b.count += it->second;
+	}
+	out.shrink_to_fit();
+	return b;
+}
+
+Compressed::pvector_type Compressed::decodeBlock(const Block& b) const {
+	pvector_type pv;
+	pv.reserve(b.pairs);
+	decode(b, [&](const double value, const unsigned int count){ pv.push_back(std::make_pair(value, count)); });
+	return pv;
+}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+Compressed::size_type Compressed::findRank(const size_type k) const {
+	// Last block whose first rank is at most k
+	const std::vector<Block>::const_iterator it = std::upper_bound(blocks.cbegin(), blocks.cend(), k,
+			[](const size_type rank, const Block& b){ return rank < b.countBefore; });
+	return static_cast<size_type>(it - blocks.cbegin()) - 1;
+}
+
+double Compressed::get(const size_type k) const {
+	if (k >= size) {
+		throw std::out_of_range("Compressed index out of range");
+	}
+	const Block& b = blocks[findRank(k)];
+	size_type rank = b.countBefore;
+	double found = b.max;
+	bool done = false;
+	decode(b, [&](const double value, const unsigned int count) {
+		if (!done && k < rank + count) {
+			found = value;
+			done = true;
+		}
+		rank += count;
+	});
+	return found;
+}
+
+void Compressed::append(const double d) {
+	const double value = binning.bin(d);
+	if (grid && !onGrid(value, binning.getStep())) {
+		throw std::invalid_argument("Value cannot be encoded on the grid of the Compressed sample set");
+	}
+	if (blocks.empty()) {
+		encode(pvector_type(1, std::make_pair(value, 1)));
+		return;
+	}
+	// Block whose range would hold the value: the last block starting at or below it
+	const std::vector<Block>::iterator upper = std::upper_bound(blocks.begin(), blocks.end(), value,
+			[](const double x, const Block& b){ return x < b.min; });
+	const size_type index = upper == blocks.begin() ? 0 : static_cast<size_type>(upper - blocks.begin()) - 1;
+	pvector_type pv = decodeBlock(blocks[index]);
+	const pvector_type::iterator it = std::lower_bound(pv.begin(), pv.end(), std::make_pair(value, 0u));
+	if (it != pv.end() && isDoubleEqual(it->first, value)) {
+		it->second++;
+	} else {
+		pv.insert(it, std::make_pair(value, 1));
+		numPairs++;
+	}
+	// Re-encode the block in place, splitting it in two once it holds twice the usual number of pairs
+	const pvector_type::const_iterator middle = pv.size() >= 2 * BLOCK_PAIRS
+			? pv.cbegin() + static_cast<std::ptrdiff_t>(BLOCK_PAIRS) : pv.cend();
+	Block& old = blocks[index];
+	encodedBytes -= old.bytes.size();
+	Block first = encodeBlock(pv.cbegin(), middle);
+	first.countBefore = old.countBefore;
+	encodedBytes += first.bytes.size();
+	old = std::move(first);
+	std::vector<Block>::iterator next = blocks.begin() + static_cast<std::ptrdiff_t>(index) + 1;
+	if (middle != pv.cend()) {
+		Block second = encodeBlock(middle, pv.cend());
+		second.countBefore = old.countBefore + old.count;
+		encodedBytes += second.bytes.size();
+		next = blocks.insert(next, std::move(second)) + 1;
+	}
+	// Only the ranks of later blocks change; their encoded bytes are untouched
+	for (std::vector<Block>::iterator b = next; b != blocks.end(); ++b) {
+		b->countBefore++;
+	}
+	size++;
+}
+
+RandomVariable::vector_type Compressed::getData() const {
+	vector_type v;
+	v.reserve(size);
+	forEach([&](const double value, const unsigned int count){ v.insert(v.end(), count, value); });
+	return v;
+}
+
+RandomVariable::pvector_type Compressed::getWData() const {
+	pvector_type pv;
+	pv.reserve(numPairs);
+	forEach([&](const double value, const unsigned int count){ pv.push_back(std::make_pair(value, count)); });
+	return pv;
+}
+
+// *------------------------------*
+// |         CALCULATIONS         |
+// *------------------------------*
+
+double Compressed::mean() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Compressed::mean");
+	double s = 0;
+	forEach([&](const double value, const unsigned int count){ s += value * count; });
+	return s / static_cast<double>(size);
+}
+
+double Compressed::median() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Compressed::median");
+	if (size == 0) {
+		throw std::invalid_argument("Median of an empty Compressed sample set is undefined");
+	}
+	if (size % 2 == 0) {
+		return (get(size / 2 - 1) + get(size / 2)) / 2;
+	}
+	return get(size / 2);
+}
+
+double Compressed::std() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Compressed::std");
+	const double m = mean();
+	double s = 0;
+	forEach([&](const double value, const unsigned int count){ s += (value - m) * (value - m) * count; });
+	return std::sqrt(s / static_cast<double>(size));
+}
+
+double Compressed::mode() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Compressed::mode");
+	f_pair best = std::make_pair(0, 0);
+	forEach([&](const double value, const unsigned int count) {
+		if (count > best.second) {
+			best = std::make_pair(value, count);
+		}
+	});
+	return best.first;
+}
+
+double Compressed::meanHeight() const {
+	return numPairs > 0 ? static_cast<double>(size) / static_cast<double>(numPairs) : 0;
+}
+
+Compressed::size_type Compressed::countAtMost(const double x) const {
+	size_type n = 0;
+	for (const Block& b : blocks) {
+		if (b.max <= x) {
+			n += b.count;
+		} else {
+			if (b.min <= x) {
+				decode(b, [&](const double value, const unsigned int count){ n += value <= x ? count : 0; });
+			}
+			break;
+		}
+	}
+	return n;
+}
+
+// *------------------------------*
+// |          SAMPLING            |
+// *------------------------------*
+
+double Compressed::sampleSingle() const {
+	double s;
+	sample(1, &s);
+	return s;
+}
+
+void Compressed::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Compressed::sample");
+	if (size == 0) {
+		throw std::invalid_argument("Cannot sample an empty Compressed sample set");
+	}
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<size_type> pick(0, size - 1);
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = get(pick(gen));
+	}
+}
+
+double Compressed::sampleSingleIcdf(const double y) const {
+	return sampleIcdf(1, vector_type(1, y))[0];
+}
+
+RandomVariable::vector_type Compressed::sampleIcdf(const unsigned int n, const vector_type& v) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Compressed::sampleIcdf");
+	if (n != v.size()) {
+		throw std::invalid_argument("Size of value vector must be equal to size integer argument");
+	}
+	if (size == 0) {
+		throw std::invalid_argument("Cannot take quantiles of an empty Compressed sample set");
+	}
+	RV_INSTRUMENT_BYTES(ICDF, n * sizeof(double));
+	vector_type samples(n);
+	for (unsigned int i = 0; i < n; i++) {
+		if (v[i] < 0 || v[i] > 1) {
+			throw std::invalid_argument("The probability parameter for Icdf() must be between 0 and 1");
+		}
+		samples[i] = get(static_cast<size_type>(std::floor(v[i] * static_cast<double>(size - 1) + 0.5)));
+	}
+	return samples;
+}
+
+// *------------------------------*
+// |           VISUAL             |
+// *------------------------------*
+
+void Compressed::printData() const {
+	forEach([](const double value, const unsigned int count){ std::cout << value << " : " << count << std::endl; });
+}
@@ -0,0 +1,225 @@
+/** Decaying Object - Implementation
+ *
+ *	@file 		Exponentially Decaying Sample Class
+ *
+ *	@brief 		Decaying Sample Class - Summary of a data stream in which every value's weight halves after
+ *				a configurable number of later appends. Mean, variance and a set of quantile estimates are
+ *				updated in O(1) per append and no values are stored, so statistics follow a drifting source
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include "Decaying.h"
+#include "Kernels.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Decaying::Decaying(const double iHalfLife, const vector_type& p) : halfLife(iHalfLife), decay(0), count(0),
+		weight(0), weight2(0), runningMean(0), squaredDeviations(0), probabilities(p), zs(), medianIndex(0) {
+	if (!(halfLife > 0)) {
+		throw std::invalid_argument("Half-life of a Decaying sample set must be larger than 0");
+	}
+	decay = std::pow(0.5, 1 / halfLife);
+	for (const double x : probabilities) {
+		if (!(x > 0 && x < 1)) {
+			throw std::invalid_argument("Tracked probabilities of a Decaying sample set must be between 0 and 1");
+		}
+	}
+	probabilities.push_back(0.5);
+	std::sort(probabilities.begin(), probabilities.end());
+	probabilities.erase(std::unique(probabilities.begin(), probabilities.end(), isDoubleEqual), probabilities.end());
+	initShape();
+	while (!isDoubleEqual(probabilities[medianIndex], 0.5)) {
+		medianIndex++;
+	}
+}
+
+Decaying::Decaying(const double iHalfLife, const vector_type& p, const vector_type& v) : Decaying(iHalfLife, p) {
+	for (const double d : v) {
+		append(d);
+	}
+}
+
+Decaying::~Decaying() {}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+void Decaying::append(const double d) {
+	// The spread of the values before d; taken before count includes d
+	const double sd = std();
+	count++;
+	if (sd > 0) {
+		// Quantiles are tracked in units of standard deviations from the mean, so a shift or rescaling of
+		// the stream is followed at the rate of the moments and only the shape is learned stochastically.
+		// Each is a gradient step on the pinball loss; the rate starts at 1 / count and then holds at the
+		// decay rate
+		const double z = (d - runningMean) / sd;
+		const double rate = std::max(1 - decay, 1 / static_cast<double>(count));
+		for (size_type i = 0; i < zs.size(); i++) {
+			zs[i] += rate * (probabilities[i] - (z < zs[i] ? 1 : 0));
+			if (i > 0 && zs[i] < zs[i - 1]) {
+				zs[i] = zs[i - 1];
+			}
+		}
+	}
+	// Weighted incremental mean and variance with every earlier weight multiplied by decay
+	weight = weight * decay + 1;
+	weight2 = weight2 * decay * decay + 1;
+	squaredDeviations *= decay;
+	const double delta = d - runningMean;
+	runningMean += delta / weight;
+	squaredDeviations += delta * (d - runningMean);
+}
+
+double Decaying::get(const size_type k) const {
+	return runningMean + std() * zs.at(k);
+}
+
+RandomVariable::vector_type Decaying::getData() const {
+	const double sd = std();
+	vector_type v(zs.size());
+	for (size_type i = 0; i < zs.size(); i++) {
+		v[i] = runningMean + sd * zs[i];
+	}
+	return v;
+}
+
+RandomVariable::pvector_type Decaying::getWData() const {
+	pvector_type pv;
+	for (const double q : getData()) {
+		pv.push_back(std::make_pair(q, 1));
+	}
+	return pv;
+}
+
+void Decaying::initShape() {
+	zs.resize(probabilities.size());
+	for (size_type i = 0; i < zs.size(); i++) {
+		zs[i] = Kernels::normInv(probabilities[i]);
+	}
+}
+
+void Decaying::clear() {
+	count = 0;
+	weight = 0;
+	weight2 = 0;
+	runningMean = 0;
+	squaredDeviations = 0;
+	initShape();
+}
+
+// *------------------------------*
+// |         CALCULATIONS         |
+// *------------------------------*
+
+double Decaying::mean() const {
+	return runningMean;
+}
+
+double Decaying::variance() const {
+	// With a very short half-life the earlier weights underflow and the effective sample size is 1
+	const double denominator = weight - weight2 / weight;
+	if (count < 2 || !(denominator > 0)) {
+		return 0;
+	}
+	return std::max(squaredDeviations, 0.0) / denominator;
+}
+
+double Decaying::std() const {
+	return std::sqrt(variance());
+}
+
+double Decaying::median() const {
+	return get(medianIndex);
+}
+
+double Decaying::mode() const {
+	return 3 * median() - 2 * mean();
+}
+
+double Decaying::meanHeight() const {
+	return 1;
+}
+
+// *------------------------------*
+// |          SAMPLING            |
+// *------------------------------*
+
+double Decaying::sampleSingle() const {
+	double s;
+	sample(1, &s);
+	return s;
+}
+
+void Decaying::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Decaying::sample");
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_real_distribution<double> uniform(0, 1);
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = sampleSingleIcdf(uniform(gen));
+	}
+}
+
+double Decaying::sampleSingleIcdf(const double y) const {
+	if (y < 0 || y > 1) {
+		throw std::invalid_argument("The probability parameter for Icdf() must be between 0 and 1");
+	}
+	if (count == 0) {
+		throw std::invalid_argument("Cannot take quantiles of an empty Decaying sample set");
+	}
+	const vector_type::const_iterator it = std::upper_bound(probabilities.cbegin(), probabilities.cend(), y);
+	double z;
+	if (it == probabilities.cbegin()) {
+		z = zs.front();
+	} else if (it == probabilities.cend()) {
+		z = zs.back();
+	} else {
+		const size_type i = static_cast<size_type>(it - probabilities.cbegin());
+		const double t = (y - probabilities[i - 1]) / (probabilities[i] - probabilities[i - 1]);
+		z = zs[i - 1] + t * (zs[i] - zs[i - 1]);
+	}
+	return runningMean + std() * z;
+}
+
+RandomVariable::vector_type Decaying::sampleIcdf(const unsigned int n, const vector_type& v) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Decaying::sampleIcdf");
+	if (n != v.size()) {
+		throw std::invalid_argument("Size of value vector must be equal to size integer argument");
+	}
+	RV_INSTRUMENT_BYTES(ICDF, n * sizeof(double));
+	vector_type samples(n);
+	for (unsigned int i = 0; i < n; i++) {
+		samples[i] = sampleSingleIcdf(v[i]);
+	}
+	return samples;
+}
+
+// *------------------------------*
+// |           VISUAL             |
+// *------------------------------*
+
+void Decaying::printData() const {
+	for (size_type i = 0; i < zs.size(); i++) {
+		std::cout << probabilities[i] << " " << get(i) << std::endl;
+	}
+}
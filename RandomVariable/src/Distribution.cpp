@@ -0,0 +1,276 @@
+/** Distribution Object - Implementation
+ *
+ *	@file 		Distribution Value Class
+ *
+ *	@brief 		Distribution Class - Value-semantic closed union of the distribution types in the library
+ *				(Normal, Lognormal, Unweighted, Weighted)
+ *	@note		Member calls are qualified (e.g. normal.Normal::cdf()) so they are bound statically
+ *				and can be inlined into the batch loops
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include "Distribution.h"
+
+// The noexcept moves of Distribution rely on the held types moving without throwing
+static_assert(std::is_nothrow_move_constructible<Unweighted>::value, "Unweighted moves must not throw");
+static_assert(std::is_nothrow_move_constructible<Weighted>::value, "Weighted moves must not throw");
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Distribution::Distribution(const Normal& d) : type(Type::NORMAL) {
+	new (&normal) Normal(d);
+}
+
+Distribution::Distribution(const Lognormal& d) : type(Type::LOGNORMAL) {
+	new (&lognormal) Lognormal(d);
+}
+
+Distribution::Distribution(Unweighted d) : type(Type::UNWEIGHTED) {
+	new (&unweighted) Unweighted(std::move(d));
+}
+
+Distribution::Distribution(Weighted d) : type(Type::WEIGHTED) {
+	new (&weighted) Weighted(std::move(d));
+}
+
+Distribution::Distribution(const Distribution& other) : type(other.type) {
+	construct(other);
+}
+
+Distribution::Distribution(Distribution&& other) noexcept : type(other.type) {
+	construct(std::move(other));
+}
+
+Distribution& Distribution::operator=(const Distribution& other) {
+	if (this != &other) {
+		// Copy first: if copying the data set throws, the held distribution is still intact
+		Distribution copy(other);
+		*this = std::move(copy);
+	}
+	return *this;
+}
+
+Distribution& Distribution::operator=(Distribution&& other) noexcept {
+	if (this != &other) {
+		destroy();
+		type = other.type;
+		construct(std::move(other));
+	}
+	return *this;
+}
+
+Distribution::~Distribution() {
+	destroy();
+}
+
+void Distribution::construct(const Distribution& other) {
+	switch (other.type) {
+	case Type::NORMAL:
+		new (&normal) Normal(other.normal);
+		break;
+	case Type::LOGNORMAL:
+		new (&lognormal) Lognormal(other.lognormal);
+		break;
+	case Type::UNWEIGHTED:
+		new (&unweighted) Unweighted(other.unweighted);
+		break;
+	case Type::WEIGHTED:
+		new (&weighted) Weighted(other.weighted);
+		break;
+	default:
+		throw std::invalid_argument("Distribution holds an unknown type");
+	}
+}
+
+void Distribution::construct(Distribution&& other) noexcept {
+	switch (other.type) {
+	case Type::NORMAL:
+		new (&normal) Normal(other.normal);
+		break;
+	case Type::LOGNORMAL:
+		new (&lognormal) Lognormal(other.lognormal);
+		break;
+	case Type::UNWEIGHTED:
+		new (&unweighted) Unweighted(std::move(other.unweighted));
+		break;
+	case Type::WEIGHTED:
+		new (&weighted) Weighted(std::move(other.weighted));
+		break;
+	default:
+		break;
+	}
+}
+
+void Distribution::destroy() {
+	switch (type) {
+	case Type::NORMAL:
+		normal.~Normal();
+		break;
+	case Type::LOGNORMAL:
+		lognormal.~Lognormal();
+		break;
+	case Type::UNWEIGHTED:
+		unweighted.~Unweighted();
+		break;
+	case Type::WEIGHTED:
+		weighted.~Weighted();
+		break;
+	default:
+		break;
+	}
+}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+const RandomVariable& Distribution::getRandomVariable() const {
+	switch (type) {
+	case Type::NORMAL:
+		return normal;
+	case Type::LOGNORMAL:
+		return lognormal;
+	case Type::UNWEIGHTED:
+		return unweighted;
+	case Type::WEIGHTED:
+		return weighted;
+	default:
+		throw std::invalid_argument("Distribution holds an unknown type");
+	}
+}
+
+void Distribution::requireParametric(const char* function) const {
+	if (!isParametric()) {
+		throw std::invalid_argument(std::string("Distribution::") + function + "() is only defined for parametric distributions");
+	}
+}
+
+// *------------------------------*
+// |     	 CALCULATIONS         |
+// *------------------------------*
+
+// Expands to a switch calling the statically bound member function f on the held distribution
+#define RV_DISTRIBUTION_DISPATCH(f) \
+	switch (type) { \
+	case Type::NORMAL: \
+		return normal.Normal::f(); \
+	case Type::LOGNORMAL: \
+		return lognormal.Lognormal::f(); \
+	case Type::UNWEIGHTED: \
+		return unweighted.Unweighted::f(); \
+	case Type::WEIGHTED: \
+		return weighted.Weighted::f(); \
+	default: \
+		throw std::invalid_argument("Distribution holds an unknown type"); \
+	}
+
+double Distribution::mean() const {
+	RV_DISTRIBUTION_DISPATCH(mean)
+}
+
+double Distribution::median() const {
+	RV_DISTRIBUTION_DISPATCH(median)
+}
+
+double Distribution::std() const {
+	RV_DISTRIBUTION_DISPATCH(std)
+}
+
+double Distribution::mode() const {
+	RV_DISTRIBUTION_DISPATCH(mode)
+}
+
+double Distribution::variance() const {
+	RV_DISTRIBUTION_DISPATCH(variance)
+}
+
+#undef RV_DISTRIBUTION_DISPATCH
+
+// Expands to a switch evaluating the statically bound member function f of the held parametric
+// distribution on every input; the switch is outside of the loop
+#define RV_DISTRIBUTION_BATCH(f) \
+	requireParametric(#f); \
+	switch (type) { \
+	case Type::NORMAL: \
+		for (size_type i = 0; i < n; i++) { \
+			out[i] = normal.Normal::f(in[i]); \
+		} \
+		break; \
+	case Type::LOGNORMAL: \
+		for (size_type i = 0; i < n; i++) { \
+			out[i] = lognormal.Lognormal::f(in[i]); \
+		} \
+		break; \
+	default: \
+		break; \
+	}
+
+double Distribution::pdf(const double x) const {
+	requireParametric("pdf");
+	return type == Type::NORMAL ? normal.Normal::pdf(x) : lognormal.Lognormal::pdf(x);
+}
+
+double Distribution::cdf(const double x) const {
+	requireParametric("cdf");
+	return type == Type::NORMAL ? normal.Normal::cdf(x) : lognormal.Lognormal::cdf(x);
+}
+
+double Distribution::icdf(const double y) const {
+	requireParametric("icdf");
+	return type == Type::NORMAL ? normal.Normal::icdf(y) : lognormal.Lognormal::icdf(y);
+}
+
+void Distribution::pdf(const size_type n, const double* in, double* out) const {
+	RV_DISTRIBUTION_BATCH(pdf)
+}
+
+void Distribution::cdf(const size_type n, const double* in, double* out) const {
+	RV_DISTRIBUTION_BATCH(cdf)
+}
+
+void Distribution::icdf(const size_type n, const double* in, double* out) const {
+	RV_DISTRIBUTION_BATCH(icdf)
+}
+
+#undef RV_DISTRIBUTION_BATCH
+
+// *------------------------------*
+// |          SAMPLING            |
+// *------------------------------*
+
+void Distribution::sample(const unsigned int n, double* out) const {
+	switch (type) {
+	case Type::NORMAL:
+		normal.Normal::sample(n, out);
+		break;
+	case Type::LOGNORMAL:
+		lognormal.Lognormal::sample(n, out);
+		break;
+	case Type::UNWEIGHTED:
+		unweighted.Unweighted::sample(n, out);
+		break;
+	case Type::WEIGHTED:
+		weighted.Weighted::sample(n, out);
+		break;
+	default:
+		throw std::invalid_argument("Distribution holds an unknown type");
+	}
+}
+
+RandomVariable::vector_type Distribution::sample(const unsigned int n) const {
+	RandomVariable::vector_type samples(n);
+	sample(n, samples.data());
+	return samples;
+}
@@ -0,0 +1,135 @@
+/** Ingest Object - Implementation
+ *
+ *	@file 		Concurrent Ingest Class
+ *
+ *	@brief 		Ingest Class - Collects values appended concurrently by many producer threads and drains them
+ *				into a NonParametric data set. Each producer fills a private block without synchronisation and
+ *				publishes full blocks onto a lock-free stack; flush() takes the whole stack with one atomic
+ *				exchange and appends its values to the data set
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include "Ingest.h"
+#include "Trace.h"
+
+constexpr Ingest::size_type Ingest::BLOCK_SIZE;
+
+namespace {
+	/** @brief	Allocates an empty block without zeroing its values */
+	Ingest::Block* newBlock() {
+		Ingest::Block* b = new Ingest::Block;
+		b->next = nullptr;
+		b->size = 0;
+		return b;
+	}
+
+	void deleteBlocks(Ingest::Block* b) {
+		while (b != nullptr) {
+			Ingest::Block* next = b->next;
+			delete b;
+			b = next;
+		}
+	}
+}
+
+// *------------------------------*
+// |           PRODUCER           |
+// *------------------------------*
+
+Ingest::Producer::Producer(Ingest& owner) : ingest(&owner), block(newBlock()) {}
+
+Ingest::Producer::Producer(Producer&& other) noexcept : ingest(other.ingest), block(other.block) {
+	other.block = nullptr;
+}
+
+Ingest::Producer::~Producer() {
+	// The last block is handed over as is; publishing would allocate a replacement only to delete it
+	if (block != nullptr && block->size > 0) {
+		ingest->push(block);
+	} else {
+		delete block;
+	}
+	block = nullptr;
+}
+
+void Ingest::Producer::flush() {
+	if (block != nullptr && block->size > 0) {
+		publish();
+	}
+}
+
+void Ingest::Producer::publish() {
+	ingest->push(block);
+	block = newBlock();
+}
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Ingest::Ingest(NonParametric& iTarget) : target(iTarget), head(nullptr) {}
+
+Ingest::~Ingest() {
+	deleteBlocks(head.exchange(nullptr, std::memory_order_acquire));
+}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+Ingest::Producer Ingest::producer() {
+	return Producer(*this);
+}
+
+void Ingest::push(Block* b) {
+	push(b, b);
+}
+
+void Ingest::push(Block* newest, Block* oldest) {
+	oldest->next = head.load(std::memory_order_relaxed);
+	while (!head.compare_exchange_weak(oldest->next, newest, std::memory_order_release, std::memory_order_relaxed)) {}
+}
+
+Ingest::size_type Ingest::flush() {
+	RV_TRACE_SPAN("Ingest::flush");
+	Block* b = head.exchange(nullptr, std::memory_order_acquire);
+	// The stack is newest first; reverse it to drain in publication order
+	Block* oldest = nullptr;
+	while (b != nullptr) {
+		Block* next = b->next;
+		b->next = oldest;
+		oldest = b;
+		b = next;
+	}
+	size_type n = 0;
+	try {
+		while (oldest != nullptr) {
+			target.append(oldest->size, oldest->values);
+			n += oldest->size;
+			Block* next = oldest->next;
+			delete oldest;
+			oldest = next;
+		}
+	} catch (...) {
+		// Publish the undrained blocks again, newest first, so their values are not lost
+		Block* const last = oldest;
+		Block* newest = nullptr;
+		while (oldest != nullptr) {
+			Block* next = oldest->next;
+			oldest->next = newest;
+			newest = oldest;
+			oldest = next;
+		}
+		if (newest != nullptr) {
+			push(newest, last);
+		}
+		throw;
+	}
+	return n;
+}
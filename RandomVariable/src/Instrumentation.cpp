@@ -0,0 +1,154 @@
+/** Instrumentation Namespace - Implementation
+ *
+ *	@file 		Instrumentation Namespace
+ *
+ *	@brief 		Instrumentation Namespace - Per-operation counters (calls, samples generated, bytes allocated,
+ *				cumulative time) for the hot paths of the library. Counters accumulate in thread-local blocks
+ *				and are summed on demand by snapshot()
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "Instrumentation.h"
+
+namespace {
+	using Instrumentation::OPERATION_COUNT;
+
+	// Fields of Instrumentation::Counters in declaration order
+	enum Field {CALLS, SAMPLES, BYTES, NANOSECONDS, FIELD_COUNT};
+
+	/** @brief	Counters of one thread; only the owning thread writes, so a relaxed load and store replace
+	 *			a locked read-modify-write while snapshot() can still read them from another thread */
+	struct Block {
+		Block() {
+			clear();
+		}
+
+		void clear() {
+			for (std::size_t op = 0; op < OPERATION_COUNT; op++) {
+				for (std::size_t f = 0; f < FIELD_COUNT; f++) {
+					values[op][f].store(0, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		std::atomic<std::uint64_t> values[OPERATION_COUNT][FIELD_COUNT];
+	};
+
+	/** @brief	Blocks of the live threads and the totals of threads that have exited */
+	struct Registry {
+		std::mutex mutex;
+		std::vector<Block*> blocks;
+		Block retired;
+	};
+
+	// Never destroyed, so threads exiting during static destruction can still retire their block
+	Registry& registry() {
+		static Registry* r = new Registry();
+		return *r;
+	}
+
+	void add(std::atomic<std::uint64_t>& a, const std::uint64_t v) {
+		a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+	}
+
+	/** @brief	Registers the thread's block on first use and folds it into the retired totals on exit */
+	struct LocalBlock {
+		LocalBlock() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			r.blocks.push_back(&block);
+		}
+
+		~LocalBlock() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			for (std::size_t op = 0; op < OPERATION_COUNT; op++) {
+				for (std::size_t f = 0; f < FIELD_COUNT; f++) {
+					add(r.retired.values[op][f], block.values[op][f].load(std::memory_order_relaxed));
+				}
+			}
+			r.blocks.erase(std::remove(r.blocks.begin(), r.blocks.end(), &block), r.blocks.end());
+		}
+
+		Block block;
+	};
+
+	Block& local() {
+		thread_local LocalBlock l;
+		return l.block;
+	}
+
+	void accumulate(const Block& b, Instrumentation::Snapshot& s) {
+		for (std::size_t op = 0; op < OPERATION_COUNT; op++) {
+			Instrumentation::Counters& c = s.counters[op];
+			c.calls += b.values[op][CALLS].load(std::memory_order_relaxed);
+			c.samples += b.values[op][SAMPLES].load(std::memory_order_relaxed);
+			c.bytes += b.values[op][BYTES].load(std::memory_order_relaxed);
+			c.nanoseconds += b.values[op][NANOSECONDS].load(std::memory_order_relaxed);
+		}
+	}
+}
+
+const char* Instrumentation::name(const Operation op) {
+	switch (op) {
+	case Operation::SAMPLE:
+		return "sample";
+	case Operation::ICDF:
+		return "icdf";
+	case Operation::STATISTICS:
+		return "statistics";
+	case Operation::TRANSLATION_SAMPLE:
+		return "translation_sample";
+	case Operation::TRANSLATION_FIT:
+		return "translation_fit";
+	case Operation::COUNT:
+	default:
+		return "unknown";
+	}
+}
+
+Instrumentation::Snapshot Instrumentation::snapshot() {
+	Snapshot s = Snapshot();
+	if (!enabled) {
+		return s;
+	}
+	Registry& r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+	accumulate(r.retired, s);
+	for (const Block* b : r.blocks) {
+		accumulate(*b, s);
+	}
+	return s;
+}
+
+void Instrumentation::reset() {
+	if (!enabled) {
+		return;
+	}
+	Registry& r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+	r.retired.clear();
+	for (Block* b : r.blocks) {
+		b->clear();
+	}
+}
+
+void Instrumentation::record(const Operation op, const std::uint64_t calls, const std::uint64_t samples,
+		const std::uint64_t bytes, const std::uint64_t nanoseconds) {
+	std::atomic<std::uint64_t>* values = local().values[static_cast<std::size_t>(op)];
+	add(values[CALLS], calls);
+	add(values[SAMPLES], samples);
+	add(values[BYTES], bytes);
+	add(values[NANOSECONDS], nanoseconds);
+}
@@ -0,0 +1,354 @@
+/** Loader Namespace - Implementation
+ *
+ *	@file 		Loader Namespace
+ *
+ *	@brief 		Loader Namespace - Contains functions for reading large CSV/newline-delimited sample
+ * 				files directly into NonParametric distributions
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RV_LOADER_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Loader.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include "Unweighted.h"
+#include "Weighted.h"
+
+namespace {
+	// Files smaller than this are parsed by fewer threads so each thread gets a useful amount of work
+	const std::size_t MIN_CHUNK_BYTES = 1 << 20;
+
+	// Exactly representable powers of ten used by the fast path of parseDouble()
+	const double POW10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+							 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+	/** @brief	Read-only view of a whole file, memory mapped where the platform allows it */
+	class MappedFile {
+	public:
+		explicit MappedFile(const std::string& path) : first(nullptr), length(0), mapped(false), buffer() {
+#ifdef RV_LOADER_MMAP
+			const int fd = open(path.c_str(), O_RDONLY);
+			if (fd >= 0) {
+				struct stat st;
+				if (fstat(fd, &st) == 0 && st.st_size > 0) {
+					length = static_cast<std::size_t>(st.st_size);
+					void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+					if (p != MAP_FAILED) {
+						madvise(p, length, MADV_SEQUENTIAL);
+						first = static_cast<const char*>(p);
+						mapped = true;
+					}
+				}
+				close(fd);
+				if (mapped || length == 0) {
+					return;
+				}
+			}
+#endif
+			// Fall back to reading the file in a single pass
+			std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+			if (!in) {
+				throw std::runtime_error("Loader::load() could not open " + path);
+			}
+			buffer.resize(static_cast<std::size_t>(in.tellg()));
+			in.seekg(0);
+			in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			first = buffer.data();
+			length = buffer.size();
+		}
+
+		~MappedFile() {
+#ifdef RV_LOADER_MMAP
+			if (mapped) {
+				munmap(const_cast<char*>(first), length);
+			}
+#endif
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		inline const char* begin() const {
+			return first;
+		}
+
+		inline const char* end() const {
+			return first + length;
+		}
+
+		inline std::size_t size() const {
+			return length;
+		}
+
+	private:
+		const char* first;
+		std::size_t length;
+		bool mapped;
+		std::vector<char> buffer;
+	};
+
+	/** @brief	Values (and optional frequencies) parsed by a single thread */
+	struct Chunk {
+		RandomVariable::vector_type values;
+		// Stays empty until the first line with a frequency column is seen
+		std::vector<unsigned int> counts;
+	};
+
+	inline bool isSeparator(const char c) {
+		return c == ',' || c == ';' || c == ' ' || c == '\t';
+	}
+
+	inline bool isDigit(const char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	/** @brief		Parses a double from [p, end), advancing p past it on success
+	 *	@details	Decimal input with at most 19 significant digits and a small exponent is converted
+	 *				exactly with a single multiplication/division (Clinger's fast path); anything else
+	 *				(long mantissas, large exponents, nan/inf) falls back to std::strtod
+	 */
+	bool parseDouble(const char*& p, const char* end, double& out) {
+		const char* s = p;
+		const bool negative = s != end && *s == '-';
+		if (s != end && (*s == '-' || *s == '+')) {
+			++s;
+		}
+		std::uint64_t mantissa = 0;
+		int digits = 0;
+		int exponent = 0;
+		bool any = false;
+		bool exact = true;
+		for (; s != end && isDigit(*s); ++s) {
+			any = true;
+			if (digits < 19) {
+				mantissa = mantissa * 10 + static_cast<std::uint64_t>(*s - '0');
+				digits += mantissa != 0;
+			} else {
+				exact = exact && *s == '0';
+				exponent++;
+			}
+		}
+		if (s != end && *s == '.') {
+			for (++s; s != end && isDigit(*s); ++s) {
+				any = true;
+				if (digits < 19) {
+					mantissa = mantissa * 10 + static_cast<std::uint64_t>(*s - '0');
+					digits += mantissa != 0;
+					exponent--;
+				} else {
+					exact = exact && *s == '0';
+				}
+			}
+		}
+		if (any && s != end && (*s == 'e' || *s == 'E')) {
+			const char* e = s + 1;
+			const bool eNegative = e != end && *e == '-';
+			if (e != end && (*e == '-' || *e == '+')) {
+				++e;
+			}
+			if (e != end && isDigit(*e)) {
+				int value = 0;
+				for (; e != end && isDigit(*e); ++e) {
+					value = value < 100000 ? value * 10 + (*e - '0') : value;
+				}
+				exponent += eNegative ? -value : value;
+				s = e;
+			}
+		}
+		const bool terminated = s == end || isSeparator(*s) || *s == '\r' || *s == '\n';
+		if (any && terminated && exact && mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+			double value = static_cast<double>(mantissa);
+			value = exponent < 0 ? value / POW10[-exponent] : value * POW10[exponent];
+			out = negative ? -value : value;
+			p = s;
+			return true;
+		}
+		// Slow path: hand the whole token to strtod, which needs a terminated string
+		const char* tokenEnd = p;
+		while (tokenEnd != end && !isSeparator(*tokenEnd) && *tokenEnd != '\r' && *tokenEnd != '\n') {
+			++tokenEnd;
+		}
+		const std::size_t length = static_cast<std::size_t>(tokenEnd - p);
+		if (length == 0) {
+			return false;
+		}
+		// Tokens are copied to the stack unless they are unusually long
+		char buffer[64];
+		std::string longToken;
+		char* token = buffer;
+		if (length < sizeof(buffer)) {
+			std::memcpy(buffer, p, length);
+			buffer[length] = '\0';
+		} else {
+			longToken.assign(p, tokenEnd);
+			token = &longToken[0];
+		}
+		char* parsed = nullptr;
+		out = std::strtod(token, &parsed);
+		if (parsed != token + length) {
+			return false;
+		}
+		p = tokenEnd;
+		return true;
+	}
+
+	/** @brief	Parses an unsigned frequency from [p, end), advancing p past it on success */
+	bool parseCount(const char*& p, const char* end, unsigned int& out) {
+		const char* s = p;
+		std::uint64_t value = 0;
+		for (; s != end && isDigit(*s) && value <= 0xFFFFFFFFu; ++s) {
+			value = value * 10 + static_cast<std::uint64_t>(*s - '0');
+		}
+		if (s == p || value > 0xFFFFFFFFu) {
+			return false;
+		}
+		out = static_cast<unsigned int>(value);
+		p = s;
+		return true;
+	}
+
+	/** @brief	Parses every line in [p, end) into chunk, allowing a header line if this is the start of the file */
+	void parseChunk(const char* p, const char* end, const bool startOfFile, Chunk& chunk) {
+		chunk.values.reserve(static_cast<std::size_t>(std::count(p, end, '\n')) + 1);
+		bool headerAllowed = startOfFile;
+		while (p < end) {
+			const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+			if (lineEnd == nullptr) {
+				lineEnd = end;
+			}
+			const char* s = p;
+			p = lineEnd + 1;
+			while (s != lineEnd && (*s == ' ' || *s == '\t')) {
+				++s;
+			}
+			if (s == lineEnd || *s == '\r' || *s == '#') {
+				continue;
+			}
+			double value = 0;
+			if (!parseDouble(s, lineEnd, value)) {
+				if (headerAllowed) {
+					headerAllowed = false;
+					continue;
+				}
+				throw std::invalid_argument("Loader::load() could not parse value on line: " + std::string(s, lineEnd));
+			}
+			headerAllowed = false;
+			while (s != lineEnd && (isSeparator(*s) || *s == '\r')) {
+				++s;
+			}
+			if (s != lineEnd) {
+				unsigned int count = 0;
+				const char* field = s;
+				if (!parseCount(s, lineEnd, count)) {
+					throw std::invalid_argument("Loader::load() could not parse frequency on line: " + std::string(field, lineEnd));
+				}
+				if (count == 0) {
+					throw std::invalid_argument("Loader::load() frequency must be positive on line: " + std::string(field, lineEnd));
+				}
+				// Only trailing whitespace may follow the frequency, so "1,2.5" or a third column is an error
+				while (s != lineEnd && (*s == ' ' || *s == '\t' || *s == '\r')) {
+					++s;
+				}
+				if (s != lineEnd) {
+					throw std::invalid_argument("Loader::load() could not parse frequency on line: " + std::string(field, lineEnd));
+				}
+				if (chunk.counts.empty()) {
+					chunk.counts.assign(chunk.values.size(), 1);
+				}
+				chunk.counts.push_back(count);
+			} else if (!chunk.counts.empty()) {
+				chunk.counts.push_back(1);
+			}
+			chunk.values.push_back(value);
+		}
+	}
+
+	/** @brief	Joins the per-thread chunks (in file order) and constructs S from them; a Weighted set sorts
+	 *			and merges the pairs on construction, so repeated values share a pair
+	 */
+	template<typename S>
+	S assemble(std::vector<Chunk>& chunks) {
+		RV_TRACE_SPAN("Loader::assemble");
+		const bool weighted = std::any_of(chunks.cbegin(), chunks.cend(), [](const Chunk& c){ return !c.counts.empty(); });
+		std::vector<std::size_t> offsets(1, 0);
+		for (const Chunk& c : chunks) {
+			offsets.push_back(offsets.back() + c.values.size());
+		}
+		if (weighted) {
+			RandomVariable::pvector_type pairs(offsets.back());
+			Parallel::run(static_cast<unsigned int>(chunks.size()), [&](const unsigned int i) {
+				const Chunk& c = chunks[i];
+				for (std::size_t j = 0; j < c.values.size(); j++) {
+					pairs[offsets[i] + j] = std::make_pair(c.values[j], c.counts.empty() ? 1 : c.counts[j]);
+				}
+			});
+			return S(pairs);
+		}
+		if (chunks.size() == 1) {
+			return S(std::move(chunks[0].values));
+		}
+		RandomVariable::vector_type values(offsets.back());
+		Parallel::run(static_cast<unsigned int>(chunks.size()), [&](const unsigned int i) {
+			std::copy(chunks[i].values.cbegin(), chunks[i].values.cend(), values.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+			RandomVariable::vector_type().swap(chunks[i].values);
+		});
+		return S(std::move(values));
+	}
+}
+
+// *------------------------------*
+// |     	   LOADING            |
+// *------------------------------*
+
+template<typename S>
+S Loader::load(const std::string& path, const unsigned int nThreads) {
+	const MappedFile file(path);
+	const std::size_t nChunks = std::min<std::size_t>(Parallel::threads(nThreads), file.size() / MIN_CHUNK_BYTES + 1);
+
+	// Chunk boundaries are moved forward to the start of the next line
+	std::vector<const char*> bounds(1, file.begin());
+	for (std::size_t i = 1; i < nChunks; i++) {
+		const char* b = std::max(bounds.back(), file.begin() + file.size() * i / nChunks);
+		const char* nl = static_cast<const char*>(std::memchr(b, '\n', static_cast<std::size_t>(file.end() - b)));
+		bounds.push_back(nl == nullptr ? file.end() : nl + 1);
+	}
+	bounds.push_back(file.end());
+
+	std::vector<Chunk> chunks(nChunks);
+	Parallel::run(static_cast<unsigned int>(nChunks), [&](const unsigned int i) {
+		RV_TRACE_SPAN("Loader::parse");
+		parseChunk(bounds[i], bounds[i + 1], i == 0, chunks[i]);
+	});
+	return assemble<S>(chunks);
+}
+
+// *------------------------------*
+// |    EXPLICIT INSTANTIATION    |
+// *------------------------------*
+
+template Unweighted Loader::load<Unweighted>(const std::string&, const unsigned int);
+template UnweightedF Loader::load<UnweightedF>(const std::string&, const unsigned int);
+template Weighted Loader::load<Weighted>(const std::string&, const unsigned int);
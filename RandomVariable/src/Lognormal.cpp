@@ -19,9 +19,11 @@
 #include <iostream>
 #include <random>
 #include <cfloat> // DBL_MIN
+#include <limits>
 
 #include "Lognormal.h"
-#include "Normal.h"
+#include "Instrumentation.h"
+#include "Trace.h"
 
 //    *-------------------------------------* 
 //    |    CONSTRUCTORS AND DESTRUCTORS     |
@@ -80,7 +82,7 @@ void Lognormal::setSigma(const double sval) {
 //    *----------------------------*
 
 double Lognormal::mean() const {
-	return exp(mu + pow(sigma, 2) / 2); 
+	return Kernels::LognormalKernel(mu, sigma).mean();
 }
 
 double Lognormal::median() const {
@@ -102,21 +104,7 @@ double Lognormal::std() const {
 }
 
 double Lognormal::variance() const {
-	return (exp(pow(sigma, 2)) - 1) * exp(2 * mu + pow(sigma, 2));
-}
-
-double Lognormal::pdf(const double x) const {
-	if (x <= 0) {
-		throw std::invalid_argument("Lognormal::pdf() cannot accept an input <= 0");
-	}
-	return  exp(-pow((log(x) - mu), 2) / (2 * variance())) / (x * sigma * sqrt(2 * M_PI)); 
-}
-
-double Lognormal::cdf(const double x) const {
-	if (x <= 0) {
-		throw std::invalid_argument("Lognormal::cdf() cannot accept an input <= 0");
-	}
-	return .5 +  .5 * std::erf((log(x) - mu) / (sigma * sqrt(2)));
+	return Kernels::LognormalKernel(mu, sigma).variance();
 }
 
 double Lognormal::icdf(double y) const {
@@ -129,16 +117,28 @@ double Lognormal::icdf(double y) const {
 		y = 1 - DBL_MIN;
 		std::cerr << "icdf(1) will return Inf; instead 1 - DBL_MIN(DBL_MIN is 1E-37 or smaller) is passed instead" << std::endl;
 	}
-	Normal n;
-	return exp(n.calcNormInv(y) * sigma + mu);
+	return Kernels::lognormalIcdf(y, mu, sigma);
 }
 
 RandomVariable::vector_type Lognormal::getParams() const {
 	return {mu, sigma};
 }
 
-RandomVariable::vector_type Lognormal::sample(const unsigned int n) const {
-	vector_type samples(n);
+void Lognormal::cdf(const unsigned int n, const double* x, double* out) const {
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = x[i] > 0 ? Kernels::lognormalCdf(x[i], mu, sigma) : 0;
+	}
+}
+
+void Lognormal::logPdf(const unsigned int n, const double* x, double* out) const {
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = x[i] > 0 ? Kernels::lognormalLogPdf(x[i], mu, sigma) : -std::numeric_limits<double>::infinity();
+	}
+}
+
+void Lognormal::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Lognormal::sample");
 	std::random_device rd;
 	// random number generator
     std::mt19937 gen(rd());
@@ -146,6 +146,29 @@ RandomVariable::vector_type Lognormal::sample(const unsigned int n) const {
 	// populate samples vector_type by seeding the distribution and generating a sample
 	// [&] signals the lambda we are passing by address so the gen object should refer
 	// to the previously created object
-	std::generate(samples.begin(), samples.end(), [&](){ return dis(gen); });
-	return samples;
+	std::generate(out, out + n, [&](){ return dis(gen); });
+}
+
+void Lognormal::sample(const unsigned int n, float* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Lognormal::sample");
+	std::random_device rd;
+    std::mt19937 gen(rd());
+	std::lognormal_distribution<float> dis(static_cast<float>(mu), static_cast<float>(sigma));
+	std::generate(out, out + n, [&](){ return dis(gen); });
+}
+
+void Lognormal::sampleIcdf(const unsigned int n, const float* y, float* out) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Lognormal::sampleIcdf");
+	const float m = static_cast<float>(mu);
+	const float s = static_cast<float>(sigma);
+	for (unsigned int i = 0; i < n; i++) {
+		float p = y[i];
+		if (p < 0 || p > 1) {
+			throw std::invalid_argument("The probability parameter for Icdf() must be larger than 0 and smaller than 1");
+		}
+		p = std::min(std::max(p, FLT_MIN), 1 - FLT_EPSILON / 2);
+		out[i] = Kernels::lognormalIcdf(p, m, s);
+	}
 }
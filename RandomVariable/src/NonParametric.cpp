@@ -16,11 +16,19 @@
 #include <iostream>
 #include <cmath>
 #include <iomanip>
+#include <algorithm>
+#include <string>
 
 #include "NonParametric.h"
 
 NonParametric::~NonParametric(){}
 
+void NonParametric::append(const size_type n, const double* values) {
+	for (size_type i = 0; i < n; i++) {
+		append(values[i]);
+	}
+}
+
 void NonParametric::graph() {
     RandomVariable::pvector_type tmp = getWData();
     std::sort(tmp.begin(), tmp.end());
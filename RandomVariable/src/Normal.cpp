@@ -20,6 +20,8 @@
 #include <cfloat> // DBL_MIN
 
 #include "Normal.h"
+#include "Instrumentation.h"
+#include "Trace.h"
 
 //    *-------------------------------------* 
 //    |    CONSTRUCTORS AND DESTRUCTORS     |
@@ -82,14 +84,6 @@ RandomVariable::vector_type Normal::getParams() const {
 //    |        CALCULATIONS	 	   |
 //    *----------------------------*
 
-double Normal::pdf(const double x) const {
-	return exp(-pow(x - mu, 2) / (2 * variance())) / sqrt(2 * M_PI * variance()); 
-}
-
-double Normal::cdf(const double x) const {
-	return .5 +  .5 * std::erf((x - mu) / (sigma * sqrt(2)));
-}
-
 double Normal::icdf(double y) const {
     if (y < 0 || y > 1) {
     	throw std::invalid_argument("The probality parameter for Icdf() must be larger than 0 and smaller than 1");
@@ -100,55 +94,28 @@ double Normal::icdf(double y) const {
 		y = 1 - DBL_MIN;
 		std::cerr << "icdf(1) will return Inf; instead 1 - DBL_MIN(DBL_MIN is 1E-37 or smaller) is passed instead" << std::endl;
 	}
-	return calcNormInv(y) * sigma + mu;
+	return Kernels::normalIcdf(y, mu, sigma);
 }
 
 double Normal::calcNormInv(const double p) const {
-    double q, r, val;
-    q = p - 0.5;
-    /*-------------- use AS 241 ---------------- */
-    /**	double ppnd16_(double *p, long *ifault)
-	 *      ALGORITHM AS241  APPL. STATIST. (1988) VOL. 37, NO. 3
-	 *	Produces the normal deviate Z corresponding to a given lower
-     *	tail area of P; Z is accurate to about 1 part in 10**16.
-     */
-    if (fabs(q) <= .425) {/* 0.075 <= p <= 0.925 */
-    	r = .180625 - q * q;
-    	val = q * (((((((r * 2509.0809287301226727 + 33430.575583588128105) * r + 67265.770927008700853) * r + 45921.953931549871457) * r + 13731.693765509461125) * r + 1971.5909503065514427) * r + 133.14166789178437745) * r + 3.387132872796366608)
-    	/ (((((((r * 5226.495278852854561 + 28729.085735721942674) * r + 39307.89580009271061) * r + 21213.794301586595867) * r + 5394.1960214247511077) * r + 687.1870074920579083) * r + 42.313330701600911252) * r + 1);
-    } else { /* closer than 0.075 from {0,1} boundary */
-    	/* r = min(p, 1-p) < 0.075 */
-   		if (q > 0) {
-    		r = 1 - p;
-    	} else {
-    		r = p;
-		}
+	return Kernels::normInv(p);
+}
 
-		try {
-    		r = squareRoot(-log(r));
-		} catch (std::invalid_argument& iva) {
-			std::cerr << iva.what() << std::endl;
-		}
-    	/* r = squareRoot(-log(r))  <==>  min(p, 1-p) = exp( - r^2 ) */
-    	
-    	if (r <= 5) { /* <==> min(p,1-p) >= exp(-25) ~= 1.3888e-11 */
-    		r += -1.6;
-    		val = (((((((r * 7.7454501427834140764e-4 + .0227238449892691845833) * r + .24178072517745061177) * r + 1.27045825245236838258) * r + 3.64784832476320460504) * r + 5.7694972214606914055) * r + 4.6303378461565452959) * r + 1.42343711074968357734)
-    		/ (((((((r * 1.05075007164441684324e-9 + 5.475938084995344946e-4) * r + .0151986665636164571966) * r + .14810397642748007459) * r + .68976733498510000455) * r + 1.6763848301838038494) * r + 2.05319162663775882187) * r + 1);
-    	} else { /* very close to  0 or 1 */
-    		r += -5;
-    		val = (((((((r * 2.01033439929228813265e-7 + 2.71155556874348757815e-5) * r + .0012426609473880784386) * r + .026532189526576123093) * r + .29656057182850489123) * r + 1.7848265399172913358) * r + 5.4637849111641143699) * r + 6.6579046435011037772)
-   			/ (((((((r * 2.04426310338993978564e-15 + 1.4215117583164458887e-7) * r + 1.8463183175100546818e-5) * r + 7.868691311456132591e-4) * r + .0148753612908506148525) * r + .13692988092273580531) * r + .59983220655588793769) * r + 1);
-    	}
-   		if (q < 0.0) {
-    		val = -val;
-    	}
-    }
-    return val;
+void Normal::cdf(const unsigned int n, const double* x, double* out) const {
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = Kernels::normalCdf(x[i], mu, sigma);
+	}
 }
 
-RandomVariable::vector_type Normal::sample(const unsigned int n) const {
-	vector_type samples(n);
+void Normal::logPdf(const unsigned int n, const double* x, double* out) const {
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = Kernels::normalLogPdf(x[i], mu, sigma);
+	}
+}
+
+void Normal::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Normal::sample");
 	std::random_device rd;
 	// random number generator
     std::mt19937 gen(rd());
@@ -156,6 +123,29 @@ RandomVariable::vector_type Normal::sample(const unsigned int n) const {
 	// populate samples vector_type by seeding the distribution and generating a sample
 	// [&] signals the lambda we are passing by address so the gen object should refer
 	// to the previously created object
-	std::generate(samples.begin(), samples.end(), [&](){ return dis(gen); });
-	return samples;
+	std::generate(out, out + n, [&](){ return dis(gen); });
+}
+
+void Normal::sample(const unsigned int n, float* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Normal::sample");
+	std::random_device rd;
+    std::mt19937 gen(rd());
+	std::normal_distribution<float> dis(static_cast<float>(mu), static_cast<float>(sigma));
+	std::generate(out, out + n, [&](){ return dis(gen); });
+}
+
+void Normal::sampleIcdf(const unsigned int n, const float* y, float* out) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Normal::sampleIcdf");
+	const float m = static_cast<float>(mu);
+	const float s = static_cast<float>(sigma);
+	for (unsigned int i = 0; i < n; i++) {
+		float p = y[i];
+		if (p < 0 || p > 1) {
+			throw std::invalid_argument("The probability parameter for Icdf() must be larger than 0 and smaller than 1");
+		}
+		p = std::min(std::max(p, FLT_MIN), 1 - FLT_EPSILON / 2);
+		out[i] = Kernels::normalIcdf(p, m, s);
+	}
 }
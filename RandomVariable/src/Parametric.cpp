@@ -15,24 +15,50 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <cmath>
 
 #include "Parametric.h"
+#include "Instrumentation.h"
+#include "Trace.h"
 
 double Parametric::sampleSingle() const {
-	return sample(1)[0];
+	double s;
+	sample(1, &s);
+	return s;
 }
 
 RandomVariable::vector_type Parametric::sampleIcdf(const unsigned int n, const RandomVariable::vector_type& v) const {
 	if (n != v.size()) {
 		throw std::invalid_argument("Size of value vector must be equal to size integer argument");
 	}
-	vector_type samples;
-	// calculates Icdf() for each value in the v vector and stores it in samples
-	// [=] signals that the lambda function can throw away each value after returning
-	std::transform(v.begin(), v.end(), samples.begin(), [=](double prob) { return icdf(prob); });
+	vector_type samples(n);
+	sampleIcdf(n, v.data(), samples.data());
+	RV_INSTRUMENT_BYTES(ICDF, n * sizeof(double));
 	return samples;
 }
 
+void Parametric::cdf(const unsigned int n, const double* x, double* out) const {
+	std::transform(x, x + n, out, [=](double v) { return cdf(v); });
+}
+
+void Parametric::logPdf(const unsigned int n, const double* x, double* out) const {
+	std::transform(x, x + n, out, [=](double v) { return std::log(pdf(v)); });
+}
+
+void Parametric::sampleIcdf(const unsigned int n, const double* y, double* out) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Parametric::sampleIcdf");
+	// calculates Icdf() for each value in y and stores it in out
+	// [=] signals that the lambda function can throw away each value after returning
+	std::transform(y, y + n, out, [=](double prob) { return icdf(prob); });
+}
+
+void Parametric::sampleIcdf(const unsigned int n, const float* y, float* out) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Parametric::sampleIcdf");
+	std::transform(y, y + n, out, [=](float prob) { return static_cast<float>(icdf(prob)); });
+}
+
 double Parametric::sampleSingleIcdf(const double P) const {
 	return icdf(P);
 }
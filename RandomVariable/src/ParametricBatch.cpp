@@ -0,0 +1,177 @@
+/** ParametricBatch Object - Implementation
+ *
+ *	@file 		Parametric Distribution Batch Class
+ *
+ *	@brief 		ParametricBatch Class - Structure-of-arrays container of many parametric distributions of
+ *				the same type
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "ParametricBatch.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+namespace {
+	// Batches are only split across threads in chunks of at least this many distributions
+	const std::size_t MIN_CHUNK = 1 << 14;
+
+	/** @brief	Derives the generator seed of a chunk (splitmix64 finalizer); unlike std::seed_seq it does not allocate */
+	std::uint64_t mixSeed(const unsigned int seed, const unsigned int chunk) {
+		std::uint64_t z = (static_cast<std::uint64_t>(seed) << 32 | chunk) + 0x9E3779B97F4A7C15ULL;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+	template<typename T>
+	void checkSigma(const T sigma) {
+		if (sigma <= 0) {
+			throw std::invalid_argument("Sigma parameter of a distribution in a batch cannot be negative or zero");
+		}
+	}
+}
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+template<typename K>
+ParametricBatch<K>::ParametricBatch() : mus(), sigmas() {}
+
+template<typename K>
+ParametricBatch<K>::ParametricBatch(vector_type m, vector_type s) : mus(std::move(m)), sigmas(std::move(s)) {
+	if (mus.size() != sigmas.size()) {
+		throw std::invalid_argument("ParametricBatch needs the same number of mu and sigma parameters");
+	}
+	std::for_each(sigmas.cbegin(), sigmas.cend(), checkSigma<value_type>);
+}
+
+template<typename K>
+ParametricBatch<K>::ParametricBatch(const size_type n, const value_type mu, const value_type sigma) : mus(n, mu), sigmas(n, sigma) {
+	checkSigma(sigma);
+}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+template<typename K>
+K ParametricBatch<K>::getKernel(const size_type k) const {
+	return K(mus.at(k), sigmas.at(k));
+}
+
+template<typename K>
+void ParametricBatch<K>::set(const size_type k, const value_type mu, const value_type sigma) {
+	checkSigma(sigma);
+	mus.at(k) = mu;
+	sigmas.at(k) = sigma;
+}
+
+template<typename K>
+void ParametricBatch<K>::append(const value_type mu, const value_type sigma) {
+	checkSigma(sigma);
+	mus.push_back(mu);
+	sigmas.push_back(sigma);
+}
+
+// *------------------------------*
+// |     	 CALCULATIONS         |
+// *------------------------------*
+
+template<typename K>
+template<typename F>
+void ParametricBatch<K>::forChunks(const unsigned int nThreads, F f) const {
+	const std::size_t n = mus.size();
+	const unsigned int threads = static_cast<unsigned int>(std::min<std::size_t>(Parallel::threads(nThreads), n / MIN_CHUNK + 1));
+	Parallel::forChunks(n, threads, [&](const unsigned int chunk, const std::size_t begin, const std::size_t end) {
+		f(chunk, begin, end);
+	});
+}
+
+// Expands to a chunked loop evaluating the kernel function f of distribution i at input x
+#define RV_BATCH_LOOP(f, x) \
+	const value_type* m = mus.data(); \
+	const value_type* s = sigmas.data(); \
+	forChunks(nThreads, [&](const unsigned int, const std::size_t begin, const std::size_t end) { \
+		RV_TRACE_SPAN("ParametricBatch::" #f); \
+		for (std::size_t i = begin; i < end; i++) { \
+			out[i] = K(m[i], s[i]).f(x); \
+		} \
+	});
+
+template<typename K>
+void ParametricBatch<K>::pdf(const value_type* in, value_type* out, const unsigned int nThreads) const {
+	RV_BATCH_LOOP(pdf, in[i])
+}
+
+template<typename K>
+void ParametricBatch<K>::cdf(const value_type* in, value_type* out, const unsigned int nThreads) const {
+	RV_BATCH_LOOP(cdf, in[i])
+}
+
+template<typename K>
+void ParametricBatch<K>::icdf(const value_type* in, value_type* out, const unsigned int nThreads) const {
+	RV_BATCH_LOOP(icdf, in[i])
+}
+
+template<typename K>
+void ParametricBatch<K>::pdf(const value_type x, value_type* out, const unsigned int nThreads) const {
+	RV_BATCH_LOOP(pdf, x)
+}
+
+template<typename K>
+void ParametricBatch<K>::cdf(const value_type x, value_type* out, const unsigned int nThreads) const {
+	RV_BATCH_LOOP(cdf, x)
+}
+
+template<typename K>
+void ParametricBatch<K>::icdf(const value_type y, value_type* out, const unsigned int nThreads) const {
+	RV_BATCH_LOOP(icdf, y)
+}
+
+#undef RV_BATCH_LOOP
+
+// *------------------------------*
+// |          SAMPLING            |
+// *------------------------------*
+
+template<typename K>
+void ParametricBatch<K>::sample(value_type* out, const unsigned int seed, const unsigned int nThreads) const {
+	const value_type* m = mus.data();
+	const value_type* s = sigmas.data();
+	// Uniform draws are kept inside the open interval (0,1) so icdf() stays finite
+	const value_type lowest = std::numeric_limits<value_type>::min();
+	const value_type highest = std::nextafter(value_type(1), value_type(0));
+	forChunks(nThreads, [&](const unsigned int chunk, const std::size_t begin, const std::size_t end) {
+		RV_TRACE_SPAN("ParametricBatch::sample");
+		std::mt19937_64 gen(mixSeed(seed, chunk));
+		for (std::size_t i = begin; i < end; i++) {
+			const double u = (static_cast<double>(gen() >> 11) + 0.5) / 9007199254740992.0;
+			const value_type y = std::min(std::max(static_cast<value_type>(u), lowest), highest);
+			out[i] = K(m[i], s[i]).icdf(y);
+		}
+	});
+}
+
+// *------------------------------*
+// |    EXPLICIT INSTANTIATION    |
+// *------------------------------*
+
+template class ParametricBatch<Kernels::NormalKernel>;
+template class ParametricBatch<Kernels::NormalKernelF>;
+template class ParametricBatch<Kernels::LognormalKernel>;
+template class ParametricBatch<Kernels::LognormalKernelF>;
@@ -19,11 +19,30 @@
 #include <climits>
 
 #include "RandomVariable.h"
+#include "Instrumentation.h"
 
 Statistics RandomVariable::stats() const {
 	return Statistics{ mean(), mode(), std() };
 }
 
+RandomVariable::vector_type RandomVariable::sample(const unsigned int n) const {
+	RV_INSTRUMENT_BYTES(SAMPLE, n * sizeof(double));
+	vector_type samples(n);
+	sample(n, samples.data());
+	return samples;
+}
+
+void RandomVariable::sample(const unsigned int n, float* out) const {
+	double buffer[256];
+	for (unsigned int i = 0; i < n; i += 256) {
+		const unsigned int m = n - i < 256 ? n - i : 256;
+		sample(m, buffer);
+		for (unsigned int j = 0; j < m; j++) {
+			out[i + j] = static_cast<float>(buffer[j]);
+		}
+	}
+}
+
 double RandomVariable::variance() const { 
 	const double sd = std();
 	return sd * sd; 
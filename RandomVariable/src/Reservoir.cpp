@@ -0,0 +1,247 @@
+/** Reservoir Object - Implementation
+ *
+ *	@file 		Reservoir Sample Class
+ *
+ *	@brief 		Reservoir Sample Class - Bounded random subsample of an unbounded stream. At most getCapacity()
+ *				values are kept, appends are O(1) amortised, and reservoirs filled on different threads can be
+ *				merged into a subsample of the combined stream
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+#include "Reservoir.h"
+#include "Weighted.h"
+#include "Kernels.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Reservoir::Reservoir(const size_type iCapacity) : Reservoir(iCapacity, std::random_device()()) {}
+
+Reservoir::Reservoir(const size_type iCapacity, const unsigned int seed) : capacity(iCapacity), count(0),
+		totalWeight(0), jump(0), entries(), gen(seed) {
+	if (capacity == 0) {
+		throw std::invalid_argument("Capacity of a Reservoir sample set must be larger than 0");
+	}
+	entries.reserve(capacity);
+}
+
+Reservoir::~Reservoir() {}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+double Reservoir::uniform() {
+	return (static_cast<double>(gen() >> 11) + 0.5) / 9007199254740992.0;
+}
+
+void Reservoir::drawJump() {
+	// Weight passed before a key exceeds the smallest kept key T is exponential: log(r) / log(T)
+	jump = std::log(uniform()) / entries.front().first;
+}
+
+void Reservoir::offer(const entry_type& e) {
+	if (entries.size() < capacity) {
+		entries.push_back(e);
+		std::push_heap(entries.begin(), entries.end(), std::greater<entry_type>());
+	} else if (e.first > entries.front().first) {
+		std::pop_heap(entries.begin(), entries.end(), std::greater<entry_type>());
+		entries.back() = e;
+		std::push_heap(entries.begin(), entries.end(), std::greater<entry_type>());
+	}
+}
+
+void Reservoir::append(const double d) {
+	append(d, 1);
+}
+
+void Reservoir::append(const double d, const double w) {
+	if (!(w > 0)) {
+		throw std::invalid_argument("Weight of a value appended to a Reservoir must be positive");
+	}
+	count++;
+	totalWeight += w;
+	if (entries.size() < capacity) {
+		offer(std::make_pair(std::log(uniform()) / w, d));
+		if (entries.size() == capacity) {
+			drawJump();
+		}
+		return;
+	}
+	jump -= w;
+	if (jump > 0) {
+		return;
+	}
+	// The key of the replacing value is uniform above the smallest kept key: r in (T^w, 1), key = r^(1/w)
+	const double threshold = std::exp(w * entries.front().first);
+	const double r = threshold + (1 - threshold) * uniform();
+	offer(std::make_pair(std::log(r) / w, d));
+	drawJump();
+}
+
+void Reservoir::append(const f_pair p) {
+	append(p.first, static_cast<double>(p.second));
+}
+
+void Reservoir::merge(const Reservoir& other) {
+	if (&other == this) {
+		// Offering its own keys again would duplicate kept values and double the counts
+		throw std::invalid_argument("Cannot merge a Reservoir into itself");
+	}
+	for (const entry_type& e : other.entries) {
+		offer(e);
+	}
+	count += other.count;
+	totalWeight += other.totalWeight;
+	if (entries.size() == capacity) {
+		drawJump();
+	}
+}
+
+double Reservoir::get(const size_type k) const {
+	return entries.at(k).second;
+}
+
+RandomVariable::vector_type Reservoir::getData() const {
+	vector_type v(entries.size());
+	for (size_type i = 0; i < entries.size(); i++) {
+		v[i] = entries[i].second;
+	}
+	return v;
+}
+
+RandomVariable::pvector_type Reservoir::getWData() const {
+	Weighted w(getData());
+	return w.getWData();
+}
+
+void Reservoir::clear() {
+	count = 0;
+	totalWeight = 0;
+	jump = 0;
+	entries.clear();
+}
+
+// *------------------------------*
+// |         CALCULATIONS         |
+// *------------------------------*
+
+double Reservoir::mean() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Reservoir::mean");
+	double s = 0;
+	for (const entry_type& e : entries) {
+		s += e.second;
+	}
+	return s / static_cast<double>(entries.size());
+}
+
+double Reservoir::median() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Reservoir::median");
+	RV_INSTRUMENT_BYTES(STATISTICS, entries.size() * sizeof(double));
+	vector_type v = getData();
+	const vector_type::iterator mid = v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2);
+	std::nth_element(v.begin(), mid, v.end());
+	if (v.size() % 2 == 0) {
+		return (*std::max_element(v.begin(), mid) + *mid) / 2;
+	}
+	return *mid;
+}
+
+double Reservoir::std() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Reservoir::std");
+	RV_INSTRUMENT_BYTES(STATISTICS, entries.size() * sizeof(double));
+	const vector_type v = getData();
+	return std::sqrt(Kernels::sumSquaredDeviations(v.cbegin(), v.cend(), mean()) / static_cast<double>(v.size() - 1));
+}
+
+double Reservoir::mode() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Reservoir::mode");
+	// The data copy; the pairs of the temporary Weighted are not counted
+	RV_INSTRUMENT_BYTES(STATISTICS, entries.size() * sizeof(double));
+	return Weighted(getData()).mode();
+}
+
+double Reservoir::meanHeight() const {
+	return static_cast<double>(entries.size()) / static_cast<double>(getWData().size());
+}
+
+// *------------------------------*
+// |          SAMPLING            |
+// *------------------------------*
+
+double Reservoir::sampleSingle() const {
+	double s;
+	sample(1, &s);
+	return s;
+}
+
+void Reservoir::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Reservoir::sample");
+	if (entries.empty()) {
+		throw std::invalid_argument("Cannot sample an empty Reservoir sample set");
+	}
+	std::random_device rd;
+	std::mt19937 local(rd());
+	std::uniform_int_distribution<size_type> pick(0, entries.size() - 1);
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = entries[pick(local)].second;
+	}
+}
+
+double Reservoir::sampleSingleIcdf(const double y) const {
+	return sampleIcdf(1, vector_type(1, y))[0];
+}
+
+RandomVariable::vector_type Reservoir::sampleIcdf(const unsigned int n, const vector_type& v) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Reservoir::sampleIcdf");
+	if (n != v.size()) {
+		throw std::invalid_argument("Size of value vector must be equal to size integer argument");
+	}
+	if (entries.empty()) {
+		throw std::invalid_argument("Cannot take quantiles of an empty Reservoir sample set");
+	}
+	RV_INSTRUMENT_BYTES(ICDF, (entries.size() + n) * sizeof(double));
+	vector_type sorted = getData();
+	std::sort(sorted.begin(), sorted.end());
+	vector_type samples(n);
+	for (unsigned int i = 0; i < n; i++) {
+		if (v[i] < 0 || v[i] > 1) {
+			throw std::invalid_argument("The probability parameter for Icdf() must be between 0 and 1");
+		}
+		samples[i] = sorted[static_cast<size_type>(std::floor(v[i] * static_cast<double>(sorted.size() - 1) + 0.5))];
+	}
+	return samples;
+}
+
+// *------------------------------*
+// |           VISUAL             |
+// *------------------------------*
+
+void Reservoir::printData() const {
+	vector_type sorted = getData();
+	std::sort(sorted.begin(), sorted.end());
+	for (const double d : sorted) {
+		std::cout << d << std::endl;
+	}
+}
@@ -0,0 +1,106 @@
+/** RunningMedian Object - Implementation
+ *
+ *	@file 		Running Median Class
+ *
+ *	@brief 		RunningMedian Class - Ordered multiset of values split into a lower and an upper half, so
+ *				the median, minimum and maximum are available in O(1) while values are inserted and
+ *				removed in O(log n)
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <iterator>
+#include <stdexcept>
+
+#include "RunningMedian.h"
+
+namespace {
+	void requireValues(const RunningMedian& rm) {
+		if (rm.getSize() == 0) {
+			throw std::invalid_argument("RunningMedian holds no values");
+		}
+	}
+}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+void RunningMedian::insert(const double x) {
+	if (low.empty() || x <= *low.rbegin()) {
+		low.insert(x);
+	} else {
+		high.insert(x);
+	}
+	rebalance();
+}
+
+void RunningMedian::erase(const double x) {
+	// Equal values may sit on both sides of the split
+	std::multiset<double>::iterator it = low.find(x);
+	if (it != low.end()) {
+		low.erase(it);
+	} else {
+		it = high.find(x);
+		if (it == high.end()) {
+			throw std::invalid_argument("Value not found in RunningMedian");
+		}
+		high.erase(it);
+	}
+	rebalance();
+}
+
+void RunningMedian::clear() {
+	low.clear();
+	high.clear();
+}
+
+double RunningMedian::at(const size_type k) const {
+	if (k < low.size()) {
+		return *std::next(low.cbegin(), static_cast<std::ptrdiff_t>(k));
+	}
+	if (k < getSize()) {
+		return *std::next(high.cbegin(), static_cast<std::ptrdiff_t>(k - low.size()));
+	}
+	throw std::out_of_range("RunningMedian rank out of range");
+}
+
+void RunningMedian::rebalance() {
+	while (low.size() > high.size() + 1) {
+		const std::multiset<double>::iterator last = std::prev(low.end());
+		high.insert(*last);
+		low.erase(last);
+	}
+	while (high.size() > low.size()) {
+		const std::multiset<double>::iterator first = high.begin();
+		low.insert(*first);
+		high.erase(first);
+	}
+}
+
+// *------------------------------*
+// |         CALCULATIONS         |
+// *------------------------------*
+
+double RunningMedian::median() const {
+	requireValues(*this);
+	if (low.size() > high.size()) {
+		return *low.rbegin();
+	}
+	return (*low.rbegin() + *high.begin()) / 2;
+}
+
+double RunningMedian::min() const {
+	requireValues(*this);
+	return *low.begin();
+}
+
+double RunningMedian::max() const {
+	requireValues(*this);
+	return high.empty() ? *low.rbegin() : *high.rbegin();
+}
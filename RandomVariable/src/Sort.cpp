@@ -0,0 +1,114 @@
+/** Sort Namespace - Implementation
+ *
+ *	@file 		Sort Namespace
+ *
+ *	@brief 		Sort Namespace - Parallel least-significant-digit radix sort of doubles on their IEEE bit
+ *				pattern, used to build Weighted sample sets from large vectors
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Sort.h"
+#include "Kernels.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+namespace {
+	constexpr unsigned int PASSES = 8;
+	constexpr std::size_t BUCKETS = 256;
+
+	using histogram_type = std::array<std::size_t, BUCKETS>;
+
+	inline std::size_t digit(const std::uint64_t key, const unsigned int pass) {
+		return static_cast<std::size_t>((key >> (8 * pass)) & 0xFF);
+	}
+}
+
+unsigned int Sort::threadsFor(const std::size_t n, const unsigned int nThreads) {
+	const std::size_t useful = n / MIN_CHUNK > 0 ? n / MIN_CHUNK : 1;
+	const std::size_t available = Parallel::threads(nThreads);
+	return static_cast<unsigned int>(std::min(useful, available));
+}
+
+void Sort::sort(double* v, const std::size_t n, const unsigned int nThreads) {
+	if (n < RADIX_MIN) {
+		std::sort(v, v + n);
+		return;
+	}
+	RV_TRACE_SPAN("Sort::sort");
+	const unsigned int nChunks = threadsFor(n, nThreads);
+	const auto chunkBegin = [&](const unsigned int c) { return n * c / nChunks; };
+	std::vector<std::uint64_t> keys(n);
+	std::vector<std::uint64_t> scratch(n);
+	// Keys and the histograms of every byte in one pass; a byte with a single bucket needs no pass
+	std::vector<std::array<histogram_type, PASSES> > all(nChunks);
+	Parallel::run(nChunks, [&](const unsigned int c) {
+		std::array<histogram_type, PASSES>& h = all[c];
+		for (histogram_type& p : h) {
+			p.fill(0);
+		}
+		for (std::size_t i = chunkBegin(c); i < chunkBegin(c + 1); i++) {
+			const std::uint64_t key = Kernels::toOrderedBits(v[i]);
+			keys[i] = key;
+			for (unsigned int pass = 0; pass < PASSES; pass++) {
+				h[pass][digit(key, pass)]++;
+			}
+		}
+	});
+	std::vector<histogram_type> counts(nChunks);
+	bool permuted = false;
+	for (unsigned int pass = 0; pass < PASSES; pass++) {
+		const std::size_t bucket = digit(keys[0], pass);
+		std::size_t same = 0;
+		for (unsigned int c = 0; c < nChunks; c++) {
+			same += all[c][pass][bucket];
+		}
+		if (same == n) {
+			continue;
+		}
+		// Per-chunk histograms of the current order. Until the first scatter it is the input order, and a
+		// single chunk's histogram is the global one, which no permutation changes
+		Parallel::run(nChunks, [&](const unsigned int c) {
+			if (!permuted || nChunks == 1) {
+				counts[c] = all[c][pass];
+				return;
+			}
+			counts[c].fill(0);
+			for (std::size_t i = chunkBegin(c); i < chunkBegin(c + 1); i++) {
+				counts[c][digit(keys[i], pass)]++;
+			}
+		});
+		// Stable scatter: bucket-major, then chunk order
+		std::size_t offset = 0;
+		for (std::size_t b = 0; b < BUCKETS; b++) {
+			for (unsigned int c = 0; c < nChunks; c++) {
+				const std::size_t count = counts[c][b];
+				counts[c][b] = offset;
+				offset += count;
+			}
+		}
+		Parallel::run(nChunks, [&](const unsigned int c) {
+			histogram_type& next = counts[c];
+			for (std::size_t i = chunkBegin(c); i < chunkBegin(c + 1); i++) {
+				scratch[next[digit(keys[i], pass)]++] = keys[i];
+			}
+		});
+		keys.swap(scratch);
+		permuted = true;
+	}
+	Parallel::run(nChunks, [&](const unsigned int c) {
+		for (std::size_t i = chunkBegin(c); i < chunkBegin(c + 1); i++) {
+			v[i] = Kernels::fromOrderedBits(keys[i]);
+		}
+	});
+}
@@ -0,0 +1,175 @@
+/** SufficientStats Object - Implementation
+ *
+ *	@file 		Sufficient Statistics Class
+ *
+ *	@brief 		Sufficient Statistics Class - Count, sum and sum of squares of a data set and of its logarithm,
+ *				gathered in one pass and updated in O(1) per value, from which Translation::fitMLE fits
+ *				Normal and Lognormal distributions
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "SufficientStats.h"
+#include "Unweighted.h"
+#include "Weighted.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+
+namespace {
+	/** @brief	Moves a sum and sum of squares of n values from deviations of one shift to deviations of another */
+	void reshift(double& s1, double& s2, const double n, const double from, const double to) {
+		const double d = from - to;
+		s2 += 2 * d * s1 + n * d * d;
+		s1 += n * d;
+	}
+}
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+SufficientStats::SufficientStats() : count(0), nonPositive(0), shift(0), logShift(0), s1(0), s2(0), l1(0), l2(0) {}
+
+SufficientStats::SufficientStats(const NonParametric& np) : SufficientStats() {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("SufficientStats::SufficientStats");
+	const auto value = [](const double x){ return x; };
+	const auto unit = [](const double){ return 1.0; };
+	if (const Unweighted* uw = dynamic_cast<const Unweighted*>(&np)) {
+		addAll(uw->values().begin(), uw->values().end(), value, unit);
+	} else if (const UnweightedF* uwf = dynamic_cast<const UnweightedF*>(&np)) {
+		addAll(uwf->values().begin(), uwf->values().end(), value, unit);
+	} else if (const Weighted* w = dynamic_cast<const Weighted*>(&np)) {
+		addAll(w->pairs().begin(), w->pairs().end(), [](const RandomVariable::f_pair& p){ return p.first; },
+				[](const RandomVariable::f_pair& p){ return static_cast<double>(p.second); });
+	} else {
+		const RandomVariable::vector_type v = np.getData();
+		addAll(v.cbegin(), v.cend(), value, unit);
+	}
+}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+template<typename It, typename V, typename W>
+void SufficientStats::addAll(It first, const It last, V valueOf, W weightOf) {
+	if (first == last) {
+		return;
+	}
+	if (count <= 0) {
+		shift = valueOf(*first);
+		logShift = shift > 0 ? std::log(shift) : 0;
+	}
+	// Local accumulators keep the loop free of stores to members
+	double n = 0, bad = 0, a1 = 0, a2 = 0, b1 = 0, b2 = 0;
+	for (; first != last; ++first) {
+		const double x = valueOf(*first);
+		const double w = weightOf(*first);
+		const double d = x - shift;
+		const bool positive = x > 0;
+		const double e = positive ? std::log(x) - logShift : 0;
+		n += w;
+		bad += positive ? 0 : w;
+		a1 += w * d;
+		a2 += w * d * d;
+		b1 += w * e;
+		b2 += w * e * e;
+	}
+	count += n;
+	nonPositive += bad;
+	s1 += a1;
+	s2 += a2;
+	l1 += b1;
+	l2 += b2;
+}
+
+void SufficientStats::add(const double x, const double w) {
+	if (w < 0) {
+		throw std::invalid_argument("SufficientStats frequency cannot be negative");
+	}
+	addAll(&x, &x + 1, [](const double v){ return v; }, [=](const double){ return w; });
+}
+
+void SufficientStats::merge(const SufficientStats& other) {
+	if (other.count <= 0) {
+		return;
+	}
+	if (count <= 0) {
+		*this = other;
+		return;
+	}
+	double o1 = other.s1, o2 = other.s2;
+	reshift(o1, o2, other.count, other.shift, shift);
+	double m1 = other.l1, m2 = other.l2;
+	reshift(m1, m2, other.count - other.nonPositive, other.logShift, logShift);
+	count += other.count;
+	nonPositive += other.nonPositive;
+	s1 += o1;
+	s2 += o2;
+	l1 += m1;
+	l2 += m2;
+}
+
+double SufficientStats::sum() const {
+	return s1 + count * shift;
+}
+
+double SufficientStats::sumSquares() const {
+	double a1 = s1, a2 = s2;
+	reshift(a1, a2, count, shift, 0);
+	return a2;
+}
+
+double SufficientStats::sumLog() const {
+	return l1 + (count - nonPositive) * logShift;
+}
+
+double SufficientStats::sumLogSquares() const {
+	double b1 = l1, b2 = l2;
+	reshift(b1, b2, count - nonPositive, logShift, 0);
+	return b2;
+}
+
+// *------------------------------*
+// |         CALCULATIONS         |
+// *------------------------------*
+
+void SufficientStats::require(const bool logs) const {
+	if (count <= 0) {
+		throw std::invalid_argument("SufficientStats of an empty data set are undefined");
+	}
+	if (logs && nonPositive > 0) {
+		throw std::invalid_argument("SufficientStats log moments require values > 0");
+	}
+}
+
+double SufficientStats::mean() const {
+	require(false);
+	return shift + s1 / count;
+}
+
+double SufficientStats::variance() const {
+	require(false);
+	const double m = s1 / count;
+	return std::fmax(s2 / count - m * m, 0);
+}
+
+double SufficientStats::logMean() const {
+	require(true);
+	return logShift + l1 / count;
+}
+
+double SufficientStats::logVariance() const {
+	require(true);
+	const double m = l1 / count;
+	return std::fmax(l2 / count - m * m, 0);
+}
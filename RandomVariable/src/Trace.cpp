@@ -0,0 +1,161 @@
+/** Trace Namespace - Implementation
+ *
+ *	@file 		Trace Namespace
+ *
+ *	@brief 		Trace Namespace - Scoped timeline spans recorded into per-thread ring buffers and exported as
+ *				Chrome trace-event JSON (chrome://tracing, Perfetto) to see where threads of a parallel run stall
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Trace.h"
+
+namespace {
+	struct Event {
+		const char* name;
+		std::uint64_t begin;
+		std::uint64_t duration;
+		std::uint32_t thread;
+	};
+
+	/** @brief	Ring buffer written only by the thread holding it; head is published with release ordering
+	 *			so dump() sees complete events up to head */
+	struct Buffer {
+		Buffer() : events(new Event[Trace::CAPACITY]), head(0), thread(0) {}
+
+		std::unique_ptr<Event[]> events;
+		std::atomic<std::uint64_t> head;
+		std::uint32_t thread;
+	};
+
+	/** @brief	Owns every buffer so spans survive the threads that recorded them; buffers of exited
+	 *			threads are handed to new threads (Parallel::run starts fresh threads on every call) */
+	struct Registry {
+		std::mutex mutex;
+		std::vector<std::unique_ptr<Buffer> > buffers;
+		std::vector<Buffer*> released;
+		std::uint32_t nextThread = 0;
+		const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+	};
+
+	// Never destroyed, so threads exiting during static destruction can still release their buffer
+	Registry& registry() {
+		static Registry* r = new Registry();
+		return *r;
+	}
+
+	struct LocalBuffer {
+		LocalBuffer() : buffer(nullptr) {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			if (r.released.empty()) {
+				r.buffers.emplace_back(new Buffer());
+				buffer = r.buffers.back().get();
+			} else {
+				buffer = r.released.back();
+				r.released.pop_back();
+			}
+			buffer->thread = r.nextThread++;
+		}
+
+		~LocalBuffer() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			r.released.push_back(buffer);
+		}
+
+		Buffer* buffer;
+	};
+
+	Buffer& local() {
+		thread_local LocalBuffer l;
+		return *l.buffer;
+	}
+
+	void writeMicroseconds(std::ostream& os, const std::uint64_t ns) {
+		char text[32];
+		std::snprintf(text, sizeof(text), "%llu.%03u", static_cast<unsigned long long>(ns / 1000), static_cast<unsigned int>(ns % 1000));
+		os << text;
+	}
+
+	/** @brief	Writes a span name as the contents of a JSON string, escaping quotes, backslashes and control characters */
+	void writeEscaped(std::ostream& os, const char* s) {
+		for (; *s != '\0'; ++s) {
+			const unsigned char c = static_cast<unsigned char>(*s);
+			if (c == '"' || c == '\\') {
+				os << '\\' << *s;
+			} else if (c < 0x20) {
+				char text[8];
+				std::snprintf(text, sizeof(text), "\\u%04x", static_cast<unsigned int>(c));
+				os << text;
+			} else {
+				os << *s;
+			}
+		}
+	}
+}
+
+std::uint64_t Trace::now() {
+	const auto elapsed = std::chrono::steady_clock::now() - registry().epoch;
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Trace::record(const char* name, const std::uint64_t begin, const std::uint64_t end) {
+	Buffer& b = local();
+	const std::uint64_t head = b.head.load(std::memory_order_relaxed);
+	Event& e = b.events[head % CAPACITY];
+	e.name = name;
+	e.begin = begin;
+	e.duration = end - begin;
+	e.thread = b.thread;
+	b.head.store(head + 1, std::memory_order_release);
+}
+
+void Trace::dump(std::ostream& os) {
+	Registry& r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+	os << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+	bool first = true;
+	for (const std::unique_ptr<Buffer>& b : r.buffers) {
+		const std::uint64_t head = b->head.load(std::memory_order_acquire);
+		for (std::uint64_t i = head > CAPACITY ? head - CAPACITY : 0; i < head; i++) {
+			const Event& e = b->events[i % CAPACITY];
+			os << (first ? "\n" : ",\n") << "{\"name\": \"";
+			writeEscaped(os, e.name);
+			os << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << e.thread << ", \"ts\": ";
+			writeMicroseconds(os, e.begin);
+			os << ", \"dur\": ";
+			writeMicroseconds(os, e.duration);
+			os << "}";
+			first = false;
+		}
+	}
+	os << "\n]}\n";
+}
+
+bool Trace::dump(const std::string& path) {
+	std::ofstream os(path);
+	dump(os);
+	return static_cast<bool>(os);
+}
+
+void Trace::clear() {
+	Registry& r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+	for (const std::unique_ptr<Buffer>& b : r.buffers) {
+		b->head.store(0, std::memory_order_relaxed);
+	}
+}
@@ -13,26 +13,175 @@
  *     			All Rights Reserved.
  */
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 #include "Translation.h"
 #include "Normal.h"
-#include "LogNormal.h"
-#include "UnWeighted.h"
+#include "Lognormal.h"
+#include "Unweighted.h"
 #include "Weighted.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+#include "Parallel.h"
+#include "Sort.h"
+
+namespace {
+	/** @brief	Maximum likelihood parameters of each family, selected by the type of the null pointer */
+	Normal fromStats(const SufficientStats& s, const Normal*) {
+		return Normal(s.mean(), std::sqrt(s.variance()));
+	}
+
+	Lognormal fromStats(const SufficientStats& s, const Lognormal*) {
+		return Lognormal(s.logMean(), std::sqrt(s.logVariance()));
+	}
+
+	// Inputs per batched cdf()/logPdf() call, small enough for buffers on the stack
+	const std::size_t BLOCK = 256;
+	// Fewest values worth a thread of their own when a candidate is split across threads
+	const std::size_t MIN_CHUNK = 1 << 14;
+
+	/** @brief	Goodness of fit sums of one candidate over a chunk of the sorted data */
+	struct Partial {
+		double ks = 0;
+		double ad = 0;
+		double logLikelihood = 0;
+		double sse = 0;
+	};
+
+	/** @brief	Accumulates the sums of candidate p over the sorted values [begin, end) of x[0, n) */
+	void evaluate(const Parametric& p, const double* x, const std::size_t begin, const std::size_t end, const std::size_t n,
+			Partial& out) {
+		double cdfs[BLOCK];
+		double logs[BLOCK];
+		const double dn = static_cast<double>(n);
+		for (std::size_t b = begin; b < end; b += BLOCK) {
+			const unsigned int m = static_cast<unsigned int>(std::min(BLOCK, end - b));
+			p.cdf(m, x + b, cdfs);
+			p.logPdf(m, x + b, logs);
+			for (unsigned int j = 0; j < m; j++) {
+				const double i = static_cast<double>(b + j);
+				const double f = cdfs[j];
+				out.ks = std::max(out.ks, std::max(f - i / dn, (i + 1) / dn - f));
+				// Anderson-Darling pairs F(x_i) with 1 - F(x_(n-1-i)); reindexed, each value contributes both terms
+				const double c = std::min(std::max(f, DBL_MIN), 1 - DBL_EPSILON / 2);
+				out.ad += (2 * i + 1) * std::log(c) + (2 * (dn - i) - 1) * std::log(1 - c);
+				out.logLikelihood += logs[j];
+				const double e = f - (i + 0.5) / dn;
+				out.sse += e * e;
+			}
+		}
+	}
+
+	/** @brief	Goodness of fit of every candidate to the n >= 1 values of x, which are sorted in place */
+	std::vector<Translation::GoodnessOfFit> compareSorted(RandomVariable::vector_type& x,
+			const std::vector<const Parametric*>& candidates, const unsigned int nThreads) {
+		const std::size_t n = x.size();
+		Sort::sort(x.data(), n, nThreads);
+
+		// Few candidates are split into chunks of the data so every thread has work
+		const std::size_t nCandidates = candidates.size();
+		const std::size_t threads = Parallel::threads(nThreads);
+		std::size_t chunks = nCandidates > 0 ? std::min(threads / nCandidates, n / MIN_CHUNK) : 1;
+		chunks = std::max(chunks, std::size_t(1));
+		std::vector<Partial> partials(nCandidates * chunks);
+		Parallel::forChunks(partials.size(), static_cast<unsigned int>(threads), [&](const unsigned int, const std::size_t first, const std::size_t last) {
+			for (std::size_t t = first; t < last; t++) {
+				const std::size_t chunk = t % chunks;
+				evaluate(*candidates[t / chunks], x.data(), n * chunk / chunks, n * (chunk + 1) / chunks, n, partials[t]);
+			}
+		});
+
+		const double dn = static_cast<double>(n);
+		// Total squares of the empirical cdf (i + 0.5) / n around its mean 0.5; 0 for a single value,
+		// whose R squared is undefined
+		const double sst = (dn * dn - 1) / (12 * dn);
+		std::vector<Translation::GoodnessOfFit> results(nCandidates);
+		for (std::size_t c = 0; c < nCandidates; c++) {
+			Partial total;
+			for (std::size_t k = c * chunks; k < (c + 1) * chunks; k++) {
+				total.ks = std::max(total.ks, partials[k].ks);
+				total.ad += partials[k].ad;
+				total.logLikelihood += partials[k].logLikelihood;
+				total.sse += partials[k].sse;
+			}
+			const double k = static_cast<double>(candidates[c]->getParams().size());
+			const double rSquared = n > 1 ? 1 - total.sse / sst : std::numeric_limits<double>::quiet_NaN();
+			results[c] = Translation::GoodnessOfFit{ c, total.ks, -dn - total.ad / dn, total.logLikelihood,
+					2 * k - 2 * total.logLikelihood, k * std::log(dn) - 2 * total.logLikelihood, rSquared };
+		}
+		std::stable_sort(results.begin(), results.end(), [](const Translation::GoodnessOfFit& a, const Translation::GoodnessOfFit& b) {
+			return a.aic < b.aic;
+		});
+		return results;
+	}
+}
 
 // *------------------------------* 
 // |     	TRANSLATION           |
 // *------------------------------*
 template<typename S>
 S Translation::sample(const Parametric* p, const unsigned int n) {
+	RV_INSTRUMENT_SCOPE(TRANSLATION_SAMPLE, n);
+	RV_TRACE_SPAN("Translation::sample");
 	std::vector<double> samples = p->sample(n);
 	return S(samples);
 }
 
 template<typename D>
 D Translation::fit(const NonParametric* samples) {
-	return D(samples->stats());
+	RV_INSTRUMENT_SCOPE(TRANSLATION_FIT, 0);
+	RV_TRACE_SPAN("Translation::fit");
+	// Normal and Lognormal are built from the mean and std only, so the sort behind mode() is skipped
+	return D(Statistics{ samples->mean(), std::numeric_limits<double>::quiet_NaN(), samples->std() });
+}
+
+template<typename D>
+D Translation::fitMLE(const NonParametric* samples) {
+	RV_INSTRUMENT_SCOPE(TRANSLATION_FIT, 0);
+	RV_TRACE_SPAN("Translation::fitMLE");
+	return fitMLE<D>(SufficientStats(*samples));
+}
+
+template<typename D>
+D Translation::fitMLE(const SufficientStats& s) {
+	return fromStats(s, static_cast<const D*>(nullptr));
+}
+
+// *------------------------------*
+// |     	 COMPARISON           |
+// *------------------------------*
+
+std::vector<Translation::GoodnessOfFit> Translation::compare(const NonParametric* samples,
+		const std::vector<const Parametric*>& candidates, const unsigned int nThreads) {
+	RV_INSTRUMENT_SCOPE(TRANSLATION_FIT, 0);
+	RV_TRACE_SPAN("Translation::compare");
+	if (std::find(candidates.cbegin(), candidates.cend(), nullptr) != candidates.cend()) {
+		throw std::invalid_argument("Translation::compare() candidates cannot be null");
+	}
+	RandomVariable::vector_type x = samples->getData();
+	const std::size_t n = x.size();
+	if (n == 0) {
+		throw std::invalid_argument("Translation::compare() needs a nonempty data set");
+	}
+	return compareSorted(x, candidates, nThreads);
+}
+
+double Translation::rSquared(const NonParametric* samples, const Parametric* p) {
+	RV_INSTRUMENT_SCOPE(TRANSLATION_FIT, 0);
+	RV_TRACE_SPAN("Translation::rSquared");
+	if (p == nullptr) {
+		throw std::invalid_argument("Translation::rSquared() distribution cannot be null");
+	}
+	RandomVariable::vector_type x = samples->getData();
+	if (x.size() < 2) {
+		throw std::invalid_argument("Translation::rSquared() needs at least 2 values");
+	}
+	return compareSorted(x, { p }, 1).front().rSquared;
 }
 
 // *------------------------------* 
@@ -41,6 +190,12 @@ D Translation::fit(const NonParametric* samples) {
 
 template Weighted Translation::sample<Weighted>(const Parametric*, const unsigned int);
 template Unweighted Translation::sample<Unweighted>(const Parametric*, const unsigned int);
+template UnweightedF Translation::sample<UnweightedF>(const Parametric*, const unsigned int);
 
 template Normal Translation::fit<Normal>(const NonParametric*);
 template Lognormal Translation::fit<Lognormal>(const NonParametric*);
+
+template Normal Translation::fitMLE<Normal>(const NonParametric*);
+template Lognormal Translation::fitMLE<Lognormal>(const NonParametric*);
+template Normal Translation::fitMLE<Normal>(const SufficientStats&);
+template Lognormal Translation::fitMLE<Lognormal>(const SufficientStats&);
@@ -19,40 +19,125 @@
 #include <iostream>
 #include <stdexcept>
 #include <iomanip>
+#include <utility>
 
 #include "Unweighted.h"
 #include "Weighted.h"
+#include "Kernels.h"
+#include "Instrumentation.h"
+#include "Trace.h"
 
 // *------------------------------* 
 // |   CONSTRUCTORS/DESTRUCTORS   |
 // *------------------------------*
 
-Unweighted::Unweighted(const RandomVariable::vector_type& v) : data(v) {}
+template<typename T>
+BasicUnweighted<T>::BasicUnweighted(const RandomVariable::vector_type& v) : data(v.cbegin(), v.cend()) {}
 
-Unweighted::Unweighted(const RandomVariable::pvector_type& v) {
-	std::for_each(v.cbegin(), v.cend(), [&](const f_pair& p){ data.insert(end(), p.second, p.first); });
+template<typename T>
+BasicUnweighted<T>::BasicUnweighted(storage_type&& v) : data(std::move(v)) {}
+
+template<typename T>
+BasicUnweighted<T>::BasicUnweighted(const RandomVariable::pvector_type& v) {
+	std::for_each(v.cbegin(), v.cend(), [&](const f_pair& p){ data.insert(end(), p.second, static_cast<T>(p.first)); });
 }
 
-Unweighted::~Unweighted(){}
+template<typename T>
+BasicUnweighted<T>::BasicUnweighted(const BasicUnweighted& other) :
+	data(other.data), order(other.order ? new RunningMedian(*other.order) : nullptr) {}
+
+template<typename T>
+BasicUnweighted<T>& BasicUnweighted<T>::operator=(const BasicUnweighted& other) {
+	// Copy first so a failed allocation leaves this set unchanged
+	BasicUnweighted copy(other);
+	return *this = std::move(copy);
+}
+
+template<typename T>
+BasicUnweighted<T>::~BasicUnweighted(){}
 
 // *------------------------------* 
 // |          ACCESSORS           |
 // *------------------------------*
 
-void Unweighted::set(const size_type k, const double d) {
-	data.at(k) = d;
+template<typename T>
+void BasicUnweighted<T>::set(const size_type k, const double d) {
+	T& slot = data.at(k);
+	if (order) {
+		order->erase(slot);
+		order->insert(static_cast<T>(d));
+	}
+	slot = static_cast<T>(d);
 }
 
-double Unweighted::get(const size_type k) const {
+template<typename T>
+double BasicUnweighted<T>::get(const size_type k) const {
 	return data.at(k);
 }
 
-void Unweighted::append(const double d) {
-	data.push_back(d);
+template<typename T>
+constexpr typename BasicUnweighted<T>::size_type BasicUnweighted<T>::MIN_CHUNK;
+
+template<typename T>
+void BasicUnweighted<T>::gather(const size_type n, const size_type* indices, double* out) const {
+	// Validate first so the copy loop has no bounds checks
+	for (size_type i = 0; i < n; i++) {
+		if (indices[i] >= data.size()) {
+			throw std::out_of_range("Unweighted index out of range");
+		}
+	}
+	const T* const p = data.data();
+	for (size_type i = 0; i < n; i++) {
+		out[i] = p[indices[i]];
+	}
+}
+
+template<typename T>
+RandomVariable::vector_type BasicUnweighted<T>::gather(const std::vector<size_type>& indices) const {
+	vector_type values(indices.size());
+	gather(indices.size(), indices.data(), values.data());
+	return values;
+}
+
+template<typename T>
+void BasicUnweighted<T>::append(const double d) {
+	data.push_back(static_cast<T>(d));
+	if (order) {
+		order->insert(data.back());
+	}
+}
+
+template<typename T>
+void BasicUnweighted<T>::append(const size_type n, const double* values) {
+	data.insert(data.end(), values, values + n);
+	if (order) {
+		for (size_type i = data.size() - n; i < data.size(); i++) {
+			order->insert(data[i]);
+		}
+	}
 }
 
-RandomVariable::pvector_type Unweighted::getWData() const {
-	Weighted w(data);
+template<typename T>
+void BasicUnweighted<T>::setMedianTracking(const bool enabled) {
+	if (!enabled) {
+		order.reset();
+	} else if (!order) {
+		order.reset(new RunningMedian());
+		rebuildMedian();
+	}
+}
+
+template<typename T>
+void BasicUnweighted<T>::rebuildMedian() {
+	order->clear();
+	for (const T x : data) {
+		order->insert(x);
+	}
+}
+
+template<typename T>
+RandomVariable::pvector_type BasicUnweighted<T>::getWData() const {
+	Weighted w(getData());
 	return w.getWData();
 }
 
@@ -60,35 +145,58 @@ RandomVariable::pvector_type Unweighted::getWData() const {
 // |         CALCULATIONS         |
 // *------------------------------*
 
-double Unweighted::mean() const {
-	return accumulate(cbegin(), cend(), 0.0) / data.size();
+template<typename T>
+double BasicUnweighted<T>::mean() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Unweighted::mean");
+	return Kernels::sum(cbegin(), cend()) / static_cast<double>(data.size());
 }
 
 	
-double Unweighted::median() const {
-	if (data.size() % 2 == 0) {
-		return (data.at(data.size() / 2) + data.at(data.size() / 2 + 1)) / 2;	
+template<typename T>
+double BasicUnweighted<T>::median() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Unweighted::median");
+	if (order) {
+		return order->median();
+	}
+	if (data.empty()) {
+		throw std::invalid_argument("Median of an empty Unweighted sample set is undefined");
 	}
-	return data.at(data.size() / 2);
+	RV_INSTRUMENT_BYTES(STATISTICS, data.size() * sizeof(T));
+	storage_type tmp = data;
+	const typename storage_type::iterator mid = tmp.begin() + static_cast<std::ptrdiff_t>(tmp.size() / 2);
+	std::nth_element(tmp.begin(), mid, tmp.end());
+	if (tmp.size() % 2 == 0) {
+		// The lower middle value is the largest of the lower half
+		return (static_cast<double>(*std::max_element(tmp.begin(), mid)) + *mid) / 2;
+	}
+	return *mid;
 }
 
-double Unweighted::meanHeight() const {
+template<typename T>
+double BasicUnweighted<T>::meanHeight() const {
 	pvector_type samples = getWData();
 	const auto function = [](const double lhs, const f_pair& rhs){ return lhs + rhs.second; };
 	return std::accumulate(samples.cbegin(), samples.cend(), 0.0, function) / static_cast<double>(data.size());
 }
 
-double Unweighted::std() const {
-    const double dMean = mean(); 
-	const auto function = [=](const double lhs, const double rhs) { return lhs + pow((rhs - dMean), 2); };
-	return sqrt(std::accumulate(cbegin(), cend(), 0.0, function) / static_cast<double>(data.size()-1));
+template<typename T>
+double BasicUnweighted<T>::std() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Unweighted::std");
+	return sqrt(Kernels::sumSquaredDeviations(cbegin(), cend(), mean()) / static_cast<double>(data.size()-1));
 }
 
-double Unweighted::mode() const {
-	vector_type tmp = data;
+template<typename T>
+double BasicUnweighted<T>::mode() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Unweighted::mode");
+	RV_INSTRUMENT_BYTES(STATISTICS, data.size() * sizeof(T));
+	storage_type tmp = data;
 	std::sort(tmp.begin(), tmp.end());
 	vector_type modes;
-	const_vtype_iterator cit = tmp.cbegin();
+	typename storage_type::const_iterator cit = tmp.cbegin();
 
 	double runValue = *cit++;
 	unsigned int runCount = 1;
@@ -120,26 +228,40 @@ double Unweighted::mode() const {
 // |           SAMPLING           |
 // *------------------------------*
 
-double Unweighted::sampleSingle() const {
+template<typename T>
+double BasicUnweighted<T>::sampleSingle() const {
 	static unsigned int count = 0;
 	return get(count++ % data.size());
 }
 
-RandomVariable::vector_type Unweighted::sample(unsigned int n) const {
-	vector_type samples(n);
+template<typename T>
+void BasicUnweighted<T>::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Unweighted::sample");
 	static unsigned int count = 0;
 	for (unsigned int i = 0; i < n; i++) {
-		samples.push_back(get(count++ % static_cast<unsigned int>(data.size())));
+		out[i] = get(count++ % static_cast<unsigned int>(data.size()));
 	}
-	return samples;
 }
 
-double Unweighted::sampleSingleIcdf(const double y) const {
+template<typename T>
+void BasicUnweighted<T>::sample(const unsigned int n, float* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Unweighted::sample");
+	static unsigned int count = 0;
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = static_cast<float>(data.at(count++ % static_cast<unsigned int>(data.size())));
+	}
+}
+
+template<typename T>
+double BasicUnweighted<T>::sampleSingleIcdf(const double y) const {
 	throw "Unimplemented method";
 	return y;
 }
 
-RandomVariable::vector_type Unweighted::sampleIcdf(const unsigned int n, const vector_type& v) const {
+template<typename T>
+RandomVariable::vector_type BasicUnweighted<T>::sampleIcdf(const unsigned int n, const vector_type& v) const {
 	throw "Unimplemented method";
 	return {static_cast<double>(n), static_cast<double>(v.size())};
 }
@@ -148,9 +270,17 @@ RandomVariable::vector_type Unweighted::sampleIcdf(const unsigned int n, const v
 // |           VISUAL             |
 // *------------------------------*
 
-void Unweighted::printData() const {
-	vector_type tmp = data;
+template<typename T>
+void BasicUnweighted<T>::printData() const {
+	storage_type tmp = data;
 	std::sort(tmp.begin(), tmp.end()); 
-	const auto function = [](const double val){ std::cout << val << std::endl; };
+	const auto function = [](const T val){ std::cout << val << std::endl; };
 	std::for_each(tmp.cbegin(), tmp.cend(), function);
 }
+
+// *------------------------------* 
+// |    EXPLICIT INSTANTIATION    |
+// *------------------------------*
+
+template class BasicUnweighted<double>;
+template class BasicUnweighted<float>;
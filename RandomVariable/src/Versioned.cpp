@@ -0,0 +1,80 @@
+/** Versioned Object - Implementation
+ *
+ *	@file 		Versioned Data Set Class
+ *
+ *	@brief 		Versioned Class - Holds a NonParametric data set as a sequence of immutable, reference-counted
+ *				versions. Readers take the current version and compute on it while writers build the next
+ *				one; a version is reclaimed when its last reader releases it
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include "Versioned.h"
+#include "Trace.h"
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+template<typename S>
+Versioned<S>::Versioned(S initial) : current(std::make_shared<const Version>(std::move(initial), 0)) {}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+template<typename S>
+typename Versioned<S>::snapshot_type Versioned<S>::snapshot() const {
+	const std::shared_ptr<const Version> v = std::atomic_load(&current);
+	// Aliasing constructor: the snapshot points at the data set and shares ownership of its version
+	return snapshot_type(v, &v->data);
+}
+
+template<typename S>
+typename Versioned<S>::size_type Versioned<S>::getVersion() const {
+	return std::atomic_load(&current)->version;
+}
+
+template<typename S>
+void Versioned<S>::append(const double d) {
+	std::lock_guard<std::mutex> lock(writer);
+	pending.push_back(d);
+}
+
+template<typename S>
+typename Versioned<S>::size_type Versioned<S>::publish() {
+	std::lock_guard<std::mutex> lock(writer);
+	if (pending.empty()) {
+		return current->version;
+	}
+	return store(copyWithPending());
+}
+
+template<typename S>
+std::shared_ptr<typename Versioned<S>::Version> Versioned<S>::copyWithPending() {
+	RV_TRACE_SPAN("Versioned::copy");
+	std::shared_ptr<Version> next = std::make_shared<Version>(current->data, current->version + 1);
+	next->data.append(pending.size(), pending.data());
+	return next;
+}
+
+template<typename S>
+typename Versioned<S>::size_type Versioned<S>::store(std::shared_ptr<Version> next) {
+	const size_type version = next->version;
+	std::atomic_store(&current, std::shared_ptr<const Version>(std::move(next)));
+	// Cleared only once the new version holds the values, so a copy or update that throws loses none
+	pending.clear();
+	return version;
+}
+
+// *------------------------------*
+// |    EXPLICIT INSTANTIATION    |
+// *------------------------------*
+
+template class Versioned<Unweighted>;
+template class Versioned<Weighted>;
@@ -21,6 +21,34 @@
 #include <string> 
 
 #include "Weighted.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+#include "Kernels.h"
+#include "Parallel.h"
+#include "Sort.h"
+
+namespace {
+	/** @brief	Appends value - frequency pairs of the runs of equal values in a sorted range */
+	void appendRuns(RandomVariable::const_vtype_iterator first, const RandomVariable::const_vtype_iterator last,
+			RandomVariable::pvector_type& out) {
+		if (first == last) {
+			return;
+		}
+		double prev = *first;
+		out.push_back(std::make_pair(prev, 0));
+		// Create weighted sample set (vector_type of pairs)
+		for (; first != last; ++first) {
+			if (!isDoubleEqual(prev, *first)) {
+				prev = *first;
+				// Create a new entries for a different double value
+				out.push_back(std::make_pair(prev, 0));
+			}
+			// The current double value frequency is incremented if a new value is encountered
+			// or the same value
+			out.back().second++;
+		}
+	}
+}
 
 // *------------------------------* 
 // |   CONSTRUCTORS/DESTRUCTORS   |
@@ -30,31 +58,52 @@ Weighted::Weighted() {
 	size = 0;
 }
 
-Weighted::Weighted(RandomVariable::vector_type v) {
+Weighted::Weighted(RandomVariable::vector_type v, const Binning& b) : binning(b) {
+	RV_TRACE_SPAN("Weighted::Weighted");
 	size = v.size();
-	if (size > 0) {
-		std::sort(v.begin(), v.end());
-		double prev = v.at(0);
-		data.push_back(std::make_pair(prev, 0));
-		// Create weighted sample set (vector_type of pairs)
-		for (double const & x : v) {
-			if (!isDoubleEqual(prev, x)) {
-				prev = x;
-				// Create a new entries for a different double value
-				data.push_back(std::make_pair(prev, 0));
+	if (size == 0) {
+		return;
+	}
+	const unsigned int nThreads = Sort::threadsFor(size);
+	if (!binning.isExact()) {
+		Parallel::forChunks(size, nThreads, [&](const unsigned int, const size_type begin, const size_type end) {
+			for (size_type i = begin; i < end; i++) {
+				v[i] = binning.bin(v[i]);
 			}
-			// The current double value frequency is incremented if a new value is encountered
-			// or the same value
-			data.back().second++;
+		});
+	}
+	Sort::sort(v.data(), size, nThreads);
+	if (nThreads == 1) {
+		appendRuns(v.cbegin(), v.cend(), data);
+		return;
+	}
+	// Run-length encode chunks in parallel, then join them, merging a run split across a chunk boundary
+	std::vector<pvector_type> runs(nThreads);
+	Parallel::forChunks(size, nThreads, [&](const unsigned int chunk, const size_type begin, const size_type end) {
+		appendRuns(v.cbegin() + static_cast<std::ptrdiff_t>(begin), v.cbegin() + static_cast<std::ptrdiff_t>(end), runs[chunk]);
+	});
+	size_type numPairs = 0;
+	for (const pvector_type& r : runs) {
+		numPairs += r.size();
+	}
+	data.reserve(numPairs);
+	for (const pvector_type& r : runs) {
+		pvector_type::const_iterator first = r.cbegin();
+		if (!data.empty() && first != r.cend() && isDoubleEqual(data.back().first, first->first)) {
+			data.back().second += first->second;
+			++first;
 		}
+		data.insert(data.end(), first, r.cend());
 	}
 }
 
-Weighted::Weighted(const RandomVariable::pvector_type& v) {
+Weighted::Weighted(const RandomVariable::pvector_type& v, const Binning& b) : binning(b) {
 	data = v;
 	// Lambda function that adds up frequencies (second value in the std::pair) of double values to get size
 	auto function = [](const unsigned int lhs, const f_pair & rhs){ return lhs + rhs.second; };
 	size = static_cast<size_type>(std::accumulate(v.begin(), v.end(), 0, function));
+	// Pairs may be unsorted or repeat a value; get(), median() and append() rely on sorted, distinct pairs
+	rebin(binning);
 }
 
 Weighted::~Weighted(){}
@@ -64,8 +113,16 @@ Weighted::~Weighted(){}
 // *------------------------------*
 
 void Weighted::set(const size_type k, const RandomVariable::f_pair p) {
-	size += p.second - data.at(k).second;
-	data.at(k) = p;
+	const f_pair old = data.at(k);
+	if (isDoubleEqual(old.first, p.first) && p.second > 0) {
+		size += p.second - old.second;
+		data[k] = p;
+		return;
+	}
+	// The value moves, so the pair is taken out and placed again in order
+	data.erase(begin() + static_cast<std::ptrdiff_t>(k));
+	size -= old.second;
+	insert(p);
 }
 
 void Weighted::setFreq(const double d, const size_type freq) { 			    
@@ -97,6 +154,29 @@ double Weighted::get(const size_type k) const {
 	return data.at(i).first;
 }
 
+void Weighted::rebin(const Binning& b) {
+	binning = b;
+	if (!binning.isExact()) {
+		for (f_pair& p : data) {
+			p.first = binning.bin(p.first);
+		}
+	}
+	mergeEqual();
+}
+
+void Weighted::mergeEqual() {
+	std::sort(begin(), end());
+	pvector_type merged;
+	for (const f_pair& p : data) {
+		if (!merged.empty() && isDoubleEqual(merged.back().first, p.first)) {
+			merged.back().second += p.second;
+		} else if (p.second > 0) {
+			merged.push_back(p);
+		}
+	}
+	data.swap(merged);
+}
+
 Weighted::ptype_iterator Weighted::findValPtr(const double val) {
 	return std::find_if(begin(), end(), [=](const f_pair& obj){ return isDoubleEqual(obj.first, val); });
 }
@@ -105,30 +185,34 @@ Weighted::const_ptype_iterator Weighted::findValPtr(const double val) const {
 	return std::find_if(cbegin(), cend(), [=](const f_pair& obj){ return isDoubleEqual(obj.first, val); });
 }
 
-void Weighted::append(const RandomVariable::f_pair p) {
-	ptype_iterator it = findValPtr(p.first);
-	if (it == cend()) {
-		data.push_back(p);
-	} else {
+void Weighted::insert(const RandomVariable::f_pair p) {
+	// One binary search finds either the pair of an equal value (at or just before the bound, since equality
+	// is within a tolerance) or the position keeping the pairs sorted
+	const ptype_iterator it = std::lower_bound(begin(), end(), p.first, [](const f_pair& q, const double x){ return q.first < x; });
+	if (it != end() && isDoubleEqual(it->first, p.first)) {
 		it->second += p.second;
+	} else if (it != begin() && isDoubleEqual((it - 1)->first, p.first)) {
+		(it - 1)->second += p.second;
+	} else if (p.second > 0) {
+		data.insert(it, p);
 	}
 	size += p.second;
 }
 
+void Weighted::append(const RandomVariable::f_pair p) {
+	insert(std::make_pair(binning.bin(p.first), p.second));
+}
+
 void Weighted::append(const double d) {
-	ptype_iterator it = findValPtr(d);
-	if (it == end()) {
-		data.push_back(std::make_pair(d, 1));
-	} else {
-		it->second++;
-	}
-	size++;
+	append(std::make_pair(d, 1u));
 }
 
 Weighted::vector_type Weighted::getData() const {
-	vector_type samples;
 	// creates an unweighted sample set from a weighted sample set
-	std::for_each(cbegin(), cend(), [&](const f_pair& p){ samples.insert(samples.end(), p.second, p.first); });
+	const Range<const_value_iterator> v = values();
+	vector_type samples;
+	samples.reserve(size);
+	samples.assign(v.begin(), v.end());
 	return samples;
 }
 
@@ -137,41 +221,53 @@ Weighted::vector_type Weighted::getData() const {
 // *------------------------------*
 
 double Weighted::mean() const {
-    const auto function = [](const double lhs, const f_pair& rhs){ return lhs + rhs.first * rhs.second; };
-	return std::accumulate(cbegin(), cend(), 0.0, function) / static_cast<double>(size);
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Weighted::mean");
+	return Kernels::weightedSum(cbegin(), cend()) / static_cast<double>(size);
 }
 
 double Weighted::median() const {
-	if (size % 2 == 0) {
-		return (data.at(size / 2).first + data.at(size / 2 + 1).first) / 2;	
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Weighted::median");
+	if (size == 0) {
+		throw std::invalid_argument("Median of an empty Weighted sample set is undefined");
+	}
+	// Ranks of the middle values (the same rank for odd sizes), found by walking the cumulative frequencies
+	const size_type lower = (size - 1) / 2;
+	const size_type upper = size / 2;
+	const_ptype_iterator pcit = cbegin();
+	size_type below = 0;
+	while (below + pcit->second <= lower) {
+		below += pcit++->second;
 	}
-	return data.at(size / 2).first;
+	const double low = pcit->first;
+	while (below + pcit->second <= upper) {
+		below += pcit++->second;
+	}
+	return (low + pcit->first) / 2;
 }
 
 double Weighted::meanHeight() const {
-    const auto function = [](const unsigned int lhs, const f_pair& rhs){ return lhs + rhs.second; };
-	return std::accumulate(cbegin(), cend(), 0.0, function) / static_cast<int>(size);
+	return Kernels::totalWeight(cbegin(), cend()) / static_cast<double>(size);
 }
 
 double Weighted::std() const {
-    const double dMean = mean(); 
-	const vector_type samples = getData();
-    const auto function = [=](const double lhs, const double rhs){ return lhs + pow((rhs - dMean), 2); };
-	return sqrt(std::accumulate(samples.cbegin(), samples.cend(), 0.0, function) / static_cast<double>(size));
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Weighted::std");
+	return sqrt(Kernels::weightedSumSquaredDeviations(cbegin(), cend(), mean()) / static_cast<double>(size));
 }
 
 double Weighted::mode() const {
-	pvector_type modes;
-	modes.push_back(std::make_pair(0, 0));
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Weighted::mode");
+	// The first of several equally frequent values is returned, without collecting the others
+	f_pair best = std::make_pair(0, 0);
 	for (const_ptype_iterator pcit = cbegin(); pcit != cend(); pcit++) {
-		if (pcit->second > modes[0].second) {
-			modes.clear();
-			modes.push_back(*pcit);
-		} else if (pcit->second == modes[0].second) {
-			modes.push_back(*pcit);
+		if (pcit->second > best.second) {
+			best = *pcit;
 		}
 	}
-	return modes[0].first;
+	return best.first;
 }
 
 // *------------------------------* 
@@ -183,13 +279,13 @@ double Weighted::sampleSingle() const {
 	return get(count++ % size);
 }
 
-RandomVariable::vector_type Weighted::sample(const unsigned int n) const {
-	vector_type samples(n);
+void Weighted::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Weighted::sample");
 	static unsigned int count = 0;
 	for (unsigned int i = 0; i < n; i++) {
-		samples.push_back(get(count++ % size));
+		out[i] = get(count++ % size);
 	}
-	return samples;
 }
 
 double Weighted::sampleSingleIcdf(const double y) const {
@@ -0,0 +1,237 @@
+/** Windowed Object - Implementation
+ *
+ *	@file 		Sliding Window Sample Class
+ *
+ *	@brief 		Windowed Sample Class - Fixed-capacity data set holding the last N values of a stream in a ring
+ *				buffer. Appending to a full window evicts the oldest value, and mean, variance, min/max and
+ *				median are maintained incrementally instead of being recomputed from the data set
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include "Windowed.h"
+#include "Kernels.h"
+#include "Instrumentation.h"
+#include "Trace.h"
+
+// *------------------------------*
+// |   CONSTRUCTORS/DESTRUCTORS   |
+// *------------------------------*
+
+Windowed::Windowed(const size_type capacity) : ring(capacity), head(0), count(0), evictions(0), runningMean(0),
+		squaredDeviations(0), order() {
+	if (capacity == 0) {
+		throw std::invalid_argument("Capacity of a Windowed sample set must be larger than 0");
+	}
+}
+
+Windowed::Windowed(const size_type capacity, const vector_type& v) : Windowed(capacity) {
+	for (const double d : v) {
+		append(d);
+	}
+}
+
+Windowed::~Windowed() {}
+
+// *------------------------------*
+// |          ACCESSORS           |
+// *------------------------------*
+
+void Windowed::append(const double d) {
+	if (std::isnan(d)) {
+		// A NaN would break the ordering of the median tracker for good, even after its eviction
+		throw std::invalid_argument("Cannot append NaN to a Windowed sample set");
+	}
+	if (isFull()) {
+		// Welford's update run backwards removes the oldest value
+		const double old = ring[head];
+		order.erase(old);
+		if (count == 1) {
+			runningMean = 0;
+			squaredDeviations = 0;
+		} else {
+			const double delta = old - runningMean;
+			runningMean -= delta / static_cast<double>(count - 1);
+			squaredDeviations -= delta * (old - runningMean);
+		}
+		count--;
+		head = (head + 1) % ring.size();
+		evictions++;
+	}
+	ring[(head + count) % ring.size()] = d;
+	count++;
+	const double delta = d - runningMean;
+	runningMean += delta / static_cast<double>(count);
+	squaredDeviations += delta * (d - runningMean);
+	order.insert(d);
+	// Amortized O(1): one exact pass per capacity evictions bounds the rounding drift
+	if (evictions >= ring.size()) {
+		recompute();
+	}
+}
+
+double Windowed::get(const size_type k) const {
+	if (k >= count) {
+		throw std::out_of_range("Windowed index out of range");
+	}
+	return ring[(head + k) % ring.size()];
+}
+
+RandomVariable::vector_type Windowed::getData() const {
+	vector_type v(count);
+	for (size_type k = 0; k < count; k++) {
+		v[k] = ring[(head + k) % ring.size()];
+	}
+	return v;
+}
+
+RandomVariable::pvector_type Windowed::getWData() const {
+	pvector_type pv;
+	order.forEach([&](const double x) {
+		if (!pv.empty() && isDoubleEqual(pv.back().first, x)) {
+			pv.back().second++;
+		} else {
+			pv.push_back(std::make_pair(x, 1));
+		}
+	});
+	return pv;
+}
+
+void Windowed::clear() {
+	head = 0;
+	count = 0;
+	evictions = 0;
+	runningMean = 0;
+	squaredDeviations = 0;
+	order.clear();
+}
+
+void Windowed::recompute() {
+	evictions = 0;
+	// When full every slot holds a value, so the sums can run over the ring in storage order
+	const vector_type::const_iterator first = ring.cbegin();
+	const vector_type::const_iterator last = isFull() ? ring.cend() : first;
+	if (first == last) {
+		return;
+	}
+	runningMean = Kernels::sum(first, last) / static_cast<double>(count);
+	squaredDeviations = Kernels::sumSquaredDeviations(first, last, runningMean);
+}
+
+// *------------------------------*
+// |         CALCULATIONS         |
+// *------------------------------*
+
+double Windowed::mean() const {
+	return runningMean;
+}
+
+double Windowed::median() const {
+	return order.median();
+}
+
+double Windowed::variance() const {
+	return count > 1 ? std::max(squaredDeviations, 0.0) / static_cast<double>(count - 1) : 0;
+}
+
+double Windowed::std() const {
+	return std::sqrt(variance());
+}
+
+double Windowed::min() const {
+	return order.min();
+}
+
+double Windowed::max() const {
+	return order.max();
+}
+
+double Windowed::mode() const {
+	RV_INSTRUMENT_SCOPE(STATISTICS, 0);
+	RV_TRACE_SPAN("Windowed::mode");
+	const pvector_type pv = getWData();
+	RV_INSTRUMENT_BYTES(STATISTICS, pv.size() * sizeof(f_pair));
+	f_pair best = std::make_pair(0, 0);
+	for (const f_pair& p : pv) {
+		if (p.second > best.second) {
+			best = p;
+		}
+	}
+	return best.first;
+}
+
+double Windowed::meanHeight() const {
+	return count > 0 ? static_cast<double>(count) / static_cast<double>(getWData().size()) : 0;
+}
+
+// *------------------------------*
+// |          SAMPLING            |
+// *------------------------------*
+
+double Windowed::sampleSingle() const {
+	double s;
+	sample(1, &s);
+	return s;
+}
+
+void Windowed::sample(const unsigned int n, double* out) const {
+	RV_INSTRUMENT_SCOPE(SAMPLE, n);
+	RV_TRACE_SPAN("Windowed::sample");
+	if (count == 0) {
+		throw std::invalid_argument("Cannot sample an empty Windowed sample set");
+	}
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<size_type> pick(0, count - 1);
+	for (unsigned int i = 0; i < n; i++) {
+		out[i] = ring[(head + pick(gen)) % ring.size()];
+	}
+}
+
+double Windowed::sampleSingleIcdf(const double y) const {
+	return sampleIcdf(1, vector_type(1, y))[0];
+}
+
+RandomVariable::vector_type Windowed::sampleIcdf(const unsigned int n, const vector_type& v) const {
+	RV_INSTRUMENT_SCOPE(ICDF, n);
+	RV_TRACE_SPAN("Windowed::sampleIcdf");
+	if (n != v.size()) {
+		throw std::invalid_argument("Size of value vector must be equal to size integer argument");
+	}
+	if (count == 0) {
+		throw std::invalid_argument("Cannot take quantiles of an empty Windowed sample set");
+	}
+	RV_INSTRUMENT_BYTES(ICDF, (count + n) * sizeof(double));
+	vector_type sorted;
+	sorted.reserve(count);
+	order.forEach([&](const double x){ sorted.push_back(x); });
+	vector_type samples(n);
+	for (unsigned int i = 0; i < n; i++) {
+		if (v[i] < 0 || v[i] > 1) {
+			throw std::invalid_argument("The probability parameter for Icdf() must be between 0 and 1");
+		}
+		samples[i] = sorted[static_cast<size_type>(std::floor(v[i] * static_cast<double>(count - 1) + 0.5))];
+	}
+	return samples;
+}
+
+// *------------------------------*
+// |           VISUAL             |
+// *------------------------------*
+
+void Windowed::printData() const {
+	for (size_type k = 0; k < count; k++) {
+		std::cout << get(k) << std::endl;
+	}
+}
@@ -1,172 +1,1096 @@
-#include <iostream>
+/** RVTests - Test Harness
+ *
+ *	@file 		Library Tests
+ *
+ *	@brief 		Runs the library tests. Global operator new is hooked (Allocations.h) to count heap allocations, so steady-state
+ *				hot paths (buffer-based sampling, batch icdf, statistics, appends of existing values) can be
+ *				asserted to perform none. Exits with the number of failed checks
+ *
+ *	@author		Aiden Cullo <aiden.cullo@nasa.gov>
+ *	@date		October 17, 2026
+ *
+ *	@copyright 	Copyright (c) 2013-2017 United States Government as represented by
+ *     			the Administrator of the National Aeronautics and Space Administration.
+ *     			All Rights Reserved.
+ */
+
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
-#include "Normal.h"
-#include "Unweighted.h"
+#include "Allocations.h"
+#include "Arena.h"
+#include "Compressed.h"
+#include "Decaying.h"
+#include "Distribution.h"
+#include "Ingest.h"
+#include "Instrumentation.h"
+#include "Kernels.h"
+#include "Loader.h"
 #include "Lognormal.h"
+#include "Normal.h"
+#include "Parallel.h"
+#include "ParametricBatch.h"
+#include "Reservoir.h"
+#include "Sort.h"
+#include "SufficientStats.h"
+#include "Trace.h"
 #include "Translation.h"
+#include "Unweighted.h"
+#include "Versioned.h"
+#include "Weighted.h"
+#include "Windowed.h"
+
+// *------------------------------*
+// |     	   HARNESS            |
+// *------------------------------*
+
+namespace {
+	unsigned int checks = 0;
+	unsigned int failures = 0;
+
+	void check(const bool ok, const char* expr, const char* file, const int line) {
+		checks++;
+		if (!ok) {
+			failures++;
+			std::cerr << file << ":" << line << ": check failed: " << expr << std::endl;
+		}
+	}
 
-double step(double x) {
-	return x*x;
+	/** @brief	Number of heap allocations made by a call of f, after a first call warms up lazily initialized state */
+	template<typename F>
+	std::size_t allocations(F f) {
+		f();
+		const std::size_t before = Allocations::count();
+		f();
+		return Allocations::count() - before;
+	}
+
+	bool near(const double a, const double b, const double tolerance) {
+		return std::fabs(a - b) <= tolerance;
+	}
+}
+
+/** @brief	Records a failure (with file and line) when cond is false */
+#define CHECK(cond) check((cond), #cond, __FILE__, __LINE__)
+
+/** @brief	Records a failure when the steady-state evaluation of the statement allocates */
+#define CHECK_NO_ALLOC(...) check(allocations([&]{ __VA_ARGS__; }) == 0, "no allocations in " #__VA_ARGS__, __FILE__, __LINE__)
+
+// *------------------------------*
+// |     	    TESTS             |
+// *------------------------------*
+
+/**	@brief		Parametric distributions agree with their closed forms */
+void testParametric() {
+	const Normal normal(5, 2);
+	CHECK(near(normal.cdf(5), 0.5, 1e-15));
+	CHECK(near(normal.icdf(normal.cdf(6.5)), 6.5, 1e-12));
+	CHECK(near(normal.pdf(5), 1 / (2 * std::sqrt(2 * std::acos(-1.0))), 1e-15));
+
+	const Lognormal lognormal(0, 1);
+	CHECK(near(lognormal.cdf(1), 0.5, 1e-15));
+	CHECK(near(lognormal.icdf(lognormal.cdf(2)), 2, 1e-12));
 }
 
-double foo() {
-	return 5;
+/**	@brief		Data set statistics on a small known set */
+void testNonParametric() {
+	const Weighted w(RandomVariable::vector_type{ 1, 2, 2, 3, 3, 3 });
+	CHECK(w.getNumPairs() == 3 && w.getSize() == 6);
+	CHECK(near(w.mean(), 14.0 / 6, 1e-15));
+	CHECK(near(w.mode(), 3, 0));
+
+	const Unweighted uw({ 1, 2, 3, 4 });
+	CHECK(near(uw.mean(), 2.5, 1e-15));
+	CHECK(near(uw.std(), std::sqrt(5.0 / 3), 1e-15));
+
+	const Normal fitted = Translation::fit<Normal>(&uw);
+	CHECK(near(fitted.mean(), 2.5, 1e-15));
 }
 
-double cal(const std::vector<double>& factors) {
-	if (factors.size() != 3) {
-		throw "cal() must be given three factors";
+/**	@brief		Loader parses values, frequencies, headers and CRLF lines, split across threads mid-line */
+void testLoader() {
+	const std::string path = "rv_loader_test.csv";
+	const auto write = [&](const std::string& text) {
+		std::ofstream out(path.c_str(), std::ios::binary);
+		out << text;
+	};
+	const auto rejects = [&](const std::string& text) {
+		write(text);
+		try {
+			Loader::load<Weighted>(path, 1);
+		} catch (const std::invalid_argument&) {
+			return true;
+		}
+		return false;
+	};
+
+	write("value\n1.5\n\n# comment\n-2\n  3e2\n");
+	CHECK(Loader::load<Unweighted>(path, 1).getData() == RandomVariable::vector_type({ 1.5, -2, 300 }));
+	write("value,count\r\n1,2\r\n4;3 \r\n5\r\n");
+	const Weighted crlf = Loader::load<Weighted>(path, 1);
+	CHECK(crlf.getNumPairs() == 3 && crlf.getSize() == 6 && near(crlf.mean(), (2 + 12 + 5) / 6.0, 1e-15));
+	CHECK(rejects("1,2.5\n") && rejects("1,2,3\n") && rejects("1\nvalue\n") && rejects("1,-2\n") && rejects("1,0\n"));
+	// Rows in any order, repeating a value, load as sorted distinct pairs like the value-only path
+	write("3,1\n1,1\n2,1\n1,2\n");
+	const Weighted rows = Loader::load<Weighted>(path, 1);
+	CHECK(rows.getNumPairs() == 3 && rows.getFreq(1) == 3 && near(rows.median(), 1, 0) && near(rows.get(0), 1, 0));
+	write("3\n1\n2\n1\n1\n");
+	CHECK(Loader::load<Weighted>(path, 1).getWData() == rows.getWData());
+
+	// Over 2 MB, so the file is split into several chunks whose boundaries fall inside lines; the first
+	// half has no frequency column, the second does, so unweighted and weighted chunks are joined
+	const unsigned int half = 150000;
+	std::string text = "x\r\n";
+	double sum = 0;
+	for (unsigned int i = 0; i < half; i++) {
+		text += std::to_string(i * 0.25) + "\r\n";
+		sum += i * 0.25;
 	}
-	return factors[0] + factors[1] + factors[2];
+	for (unsigned int i = 0; i < half; i++) {
+		text += std::to_string(i * 0.5) + ",2\n";
+		sum += 2 * i * 0.5;
+	}
+	write(text);
+	const Unweighted serial = Loader::load<Unweighted>(path, 1);
+	const Unweighted parallel = Loader::load<Unweighted>(path, 4);
+	CHECK(parallel.getData() == serial.getData() && serial.getData().size() == 3 * half);
+	CHECK(near(std::accumulate(parallel.values().begin(), parallel.values().end(), 0.0), sum, 1e-6 * sum));
+	const Weighted pairs = Loader::load<Weighted>(path, 4);
+	// Multiples of 0.5 below half * 0.25 appear in both halves and share a pair
+	CHECK(pairs.getNumPairs() == half + half / 2 && pairs.getSize() == 3 * half);
+	CHECK(near(pairs.median(), serial.median(), 0) && near(pairs.get(0), 0, 0) && near(pairs.get(3 * half - 1), (half - 1) * 0.5, 0));
+	std::remove(path.c_str());
 }
 
-NonParametric* sampleDistParams(Parametric* p) {
-	return new Unweighted(Translation::sample<Unweighted>(p, 125));
+/**	@brief		Distribution forwards to the held distribution and moves it without copying the data set */
+void testDistribution() {
+	const Normal normal(1, 2);
+	const Lognormal lognormal(0.5, 0.25);
+	const Unweighted uw({ 4, 1, 3, 2, 5 });
+	const Weighted w(RandomVariable::vector_type{ 1, 2, 2, 3 });
+	const Distribution dn(normal), dl(lognormal), du(uw), dw(w);
+
+	CHECK(std::is_nothrow_move_constructible<Distribution>::value && std::is_nothrow_move_assignable<Distribution>::value);
+	CHECK(sizeof(Distribution) <= sizeof(Weighted) + sizeof(double) && sizeof(Unweighted) <= sizeof(Weighted));
+	CHECK(near(dn.get<Normal>().getSigma(), 2, 0) && near(dl.get<Lognormal>().getMu(), 0.5, 0));
+	CHECK(du.get<Unweighted>().getData() == uw.getData() && dw.get<Weighted>().getNumPairs() == 3);
+	bool thrown = false;
+	try {
+		dn.get<Weighted>();
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	CHECK(thrown);
+
+	const auto mean = [](const RandomVariable& rv){ return rv.mean(); };
+	CHECK(near(dn.visit(mean), 1, 0) && near(du.visit(mean), 3, 0) && near(dw.visit(mean), 2, 0));
+	CHECK(near(du.median(), uw.median(), 0) && near(du.std(), uw.std(), 0) && near(dw.mean(), w.mean(), 0));
+	CHECK(near(dl.mean(), lognormal.mean(), 0) && near(dl.variance(), lognormal.variance(), 0));
+
+	const double x[] = { -1, 0.5, 1, 3 };
+	const double y[] = { 0.01, 0.3, 0.5, 0.99 };
+	double pdf[4], cdf[4], icdf[4];
+	bool same = true;
+	for (const Distribution* d : { &dn, &dl }) {
+		const Parametric& p = d == &dn ? static_cast<const Parametric&>(normal) : lognormal;
+		// The lognormal is only defined for positive inputs
+		const std::size_t first = d == &dn ? 0 : 1;
+		d->pdf(4 - first, x + first, pdf);
+		d->cdf(4 - first, x + first, cdf);
+		d->icdf(4, y, icdf);
+		for (std::size_t i = 0; i < 4; i++) {
+			if (i + first < 4) {
+				same = same && near(pdf[i], p.pdf(x[i + first]), 0) && near(cdf[i], p.cdf(x[i + first]), 0);
+				same = same && near(d->pdf(x[i + first]), p.pdf(x[i + first]), 0);
+			}
+			same = same && near(icdf[i], p.icdf(y[i]), 0);
+		}
+	}
+	CHECK(same);
+	thrown = false;
+	try {
+		du.cdf(4, x, cdf);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	CHECK(thrown);
+
+	// Growing the vector moves the held data sets, so their storage keeps its address
+	std::vector<Distribution> all;
+	all.push_back(du);
+	const double* storage = &*all[0].get<Unweighted>().values().begin();
+	for (unsigned int i = 0; i < 100; i++) {
+		all.push_back(i % 2 == 0 ? dw : dn);
+	}
+	CHECK(&*all[0].get<Unweighted>().values().begin() == storage);
+
+	Distribution assigned(normal);
+	assigned = du;
+	CHECK(assigned.getType() == Distribution::Type::UNWEIGHTED && assigned.get<Unweighted>().getData() == uw.getData());
+	assigned = dl;
+	CHECK(assigned.getType() == Distribution::Type::LOGNORMAL && near(assigned.get<Lognormal>().getSigma(), 0.25, 0));
 }
 
-void printParams(RandomVariable * rv) {
-	std::cout << rv->mean() << std::endl;
-	std::cout << rv->std() << std::endl;
+/**	@brief		Kernels match published normal quantiles in every AS241 region and the lognormal closed forms */
+void testKernels() {
+	// Reference quantiles of the standard normal (central, intermediate and tail regions)
+	CHECK(near(Kernels::normInv(0.5), 0, 0));
+	CHECK(near(Kernels::normInv(0.3), -0.5244005127080407, 1e-15));
+	CHECK(near(Kernels::normInv(0.025), -1.9599639845400538, 1e-15));
+	CHECK(near(Kernels::normInv(0.975), 1.9599639845400538, 1e-15));
+	CHECK(near(Kernels::normInv(1e-10), -6.361340902404056, 1e-14));
+	CHECK(near(Kernels::normInv(1 - 1e-10), 6.361340902404056, 1e-6));
+	// Deep tail: checked through the complementary cdf, which keeps its relative precision there
+	const double z = Kernels::normInv(1e-300);
+	CHECK(z < -37 && near(0.5 * std::erfc(-z / Kernels::SQRT_2) / 1e-300, 1, 1e-12));
+	CHECK(near(Kernels::normInv(0.025f), -1.959964f, 1e-6f));
+
+	const Kernels::NormalKernel nk(5, 2);
+	const Normal normal(5, 2);
+	CHECK(near(nk.icdf(0.025), 5 - 2 * 1.9599639845400538, 1e-14) && near(normal.icdf(0.025), nk.icdf(0.025), 0));
+	CHECK(near(nk.pdf(7), std::exp(-0.5) / (2 * Kernels::SQRT_2PI), 1e-16) && near(normal.pdf(7), nk.pdf(7), 0));
+
+	// Regression: Lognormal::pdf() used to divide by the variance of the lognormal instead of sigma^2
+	const Lognormal lognormal(0.5, 0.75);
+	const Kernels::LognormalKernel lk(0.5, 0.75);
+	CHECK(near(lognormal.pdf(2), 0.2572866664467846, 1e-15) && near(lk.pdf(2), lognormal.pdf(2), 0));
+	CHECK(near(Lognormal(0, 1).pdf(std::exp(1.0)), 0.08901605491595149, 1e-16));
+	CHECK(near(std::exp(Kernels::lognormalLogPdf(2.0, 0.5, 0.75)), 0.2572866664467846, 1e-15));
+	CHECK(near(lognormal.cdf(std::exp(0.5)), 0.5, 1e-15) && near(lognormal.icdf(0.5), std::exp(0.5), 1e-15));
+	CHECK(near(lognormal.icdf(0.025), std::exp(0.5 - 0.75 * 1.9599639845400538), 1e-14));
 }
 
-int main(){
-#if 0
-	// TEST #1
-	/**	@brief		Testing the creation of a basic normal distribution and sampling from a 
-	 *				Parametric distribution to a NonParametric distribution 
-	 */
-	//==============================================================================================
-	Parametric* pExample = new Normal(5, .5);
-	Unweighted pnExample = Translation::sample<Unweighted>(pExample, 1000);
-	pnExample.printData();
-	//==============================================================================================
+/**	@brief		Batch pdf/cdf/icdf match Normal and Lognormal element-wise across uneven multi-threaded chunks */
+void testParametricBatch() {
+	// Large enough to be split across threads, and not a multiple of the chunk or thread count
+	const std::size_t n = 3 * (1 << 14) + 7;
+	RandomVariable::vector_type mus(n), sigmas(n), x(n), y(n);
+	for (std::size_t i = 0; i < n; i++) {
+		mus[i] = static_cast<double>(i % 13) * 0.25 - 1;
+		sigmas[i] = 0.1 + static_cast<double>(i % 7) * 0.3;
+		x[i] = 0.05 + static_cast<double>(i % 29) * 0.2;
+		y[i] = (static_cast<double>(i % 997) + 0.5) / 997;
+	}
+	const NormalBatch normals(mus, sigmas);
+	const LognormalBatch lognormals(mus, sigmas);
+	RandomVariable::vector_type pdf(n), cdf(n), icdf(n), shared(n);
+
+	bool same = true;
+	for (const unsigned int threads : { 1u, 4u }) {
+		normals.pdf(x.data(), pdf.data(), threads);
+		normals.cdf(x.data(), cdf.data(), threads);
+		normals.icdf(y.data(), icdf.data(), threads);
+		normals.cdf(0.5, shared.data(), threads);
+		for (std::size_t i = 0; i < n; i++) {
+			const Normal d(mus[i], sigmas[i]);
+			same = same && near(pdf[i], d.pdf(x[i]), 0) && near(cdf[i], d.cdf(x[i]), 0);
+			same = same && near(icdf[i], d.icdf(y[i]), 0) && near(shared[i], d.cdf(0.5), 0);
+		}
+		lognormals.pdf(x.data(), pdf.data(), threads);
+		lognormals.cdf(x.data(), cdf.data(), threads);
+		lognormals.icdf(y.data(), icdf.data(), threads);
+		lognormals.pdf(0.5, shared.data(), threads);
+		for (std::size_t i = 0; i < n; i++) {
+			const Lognormal d(mus[i], sigmas[i]);
+			same = same && near(pdf[i], d.pdf(x[i]), 0) && near(cdf[i], d.cdf(x[i]), 0);
+			same = same && near(icdf[i], d.icdf(y[i]), 0) && near(shared[i], d.pdf(0.5), 0);
+		}
+	}
+	CHECK(same);
+
+	// Outputs may alias the inputs
+	RandomVariable::vector_type inPlace(y);
+	normals.icdf(inPlace.data(), inPlace.data(), 4);
+	normals.icdf(y.data(), icdf.data(), 1);
+	CHECK(inPlace == icdf);
+}
 
-	// TEST #2
-	/**	@brief		Testing accessor methods set and get, then examining contents */		
-	//==============================================================================================
+/**	@brief		Windowed statistics match an Unweighted set of the last capacity values */
+void testWindowed() {
+	const std::size_t capacity = 64;
+	Windowed win(capacity);
+	std::vector<double> stream;
 	for (unsigned int i = 0; i < 1000; i++) {
-		// Replace with indexing, it's more natural
-		pnExample.set(i, step(pnExample.get(i)));
-	}
-	pnExample.printData();
-	//==============================================================================================
-
-	// TEST #3
-	/**	@brief		Testing mean and standard deviation methods	
-	 *	@details	Functions that don't start with get can contain calculations,
-	 *				in the case of a Normal distribution, the mu and sigma attributes
-	 *				happen to correspond to mean and standard deviation, but this
-	 *				usually is not the case
-	 */
-	//==============================================================================================
-	std::cout << pnExample->mean() << std::endl;
-	std::cout << pnExample->std() << std::endl;
-	//==============================================================================================
-
-	// TEST #4
-	/**	@brief		Testing implicit copy constructor of Normal(and Parametric)
-	 *				distribution
-	 */
-	//==============================================================================================
-	Normal* pExample_1 = new Normal(*pExample); // or RandomVariable* pExample_1 = new Normal(*pExample);
-	//==============================================================================================
-
-	// TEST #5
-	/**	@brief		Testing function for accessing parameters	*/
-	//==============================================================================================
-	std::vector<double> params = pExample->getParams();
-	for (std::vector<double>::iterator it = params.begin(); it != params.end(); it++) {
-		std::cout << *it << std::endl;
-	}
-	//==============================================================================================
-
-	// TEST #6
-	/**	@brief		Creating a NonParametric pointer pointing to a dynamically
-	 *				allocated Unweighted object, then appending values to the data set
-	 */
-	//==============================================================================================
-	NonParametric* fooExample = new Unweighted();
-	for (unsigned int i = 0; i < 100; i++) {
-		fooExample->append(foo());
-	}
-	fooExample->printData();
-	//==============================================================================================
-
-	// TEST #7
-	/**	@brief		Appending values to an Unweighted object, fitting to a Normal distribution
-	 *				then calculating tenth percentile and pdf/cdf of the value of foo()	
-	 */
-	//==============================================================================================
-	for (unsigned int i = 1; i < 100; i++) {
-		fooExample->append(foo()); // changed foo call for testing purposes
-		std::cout << "mean: " << fooExample->mean() << std::endl;
-		std::cout << "variance: " << fooExample->variance() << std::endl;
-	}
-	Parametric* n = new Normal(Translation:fit<Normal>(fooExample));
-	double num = foo();
-	std::cout << "Tenth percentile: "<< norm->icdf(0.1) << std::endl;
-	std::cout << "Cumulative probability of " << num << ": " << norm->cdf(num) << std::endl;
-	std::cout << "Probability of " << num << ": " << norm->pdf(num) << std::endl;
-
-	// TEST #8
-	/**	@brief		Testing getter function on NonParametric distribution object	*/
-	//==============================================================================================
-	std::cout << fooExample->get(99) << std::endl; 
-
-	// TEST #9
-	/**	@brief		Fitting an unweighted object to lognormal and normal distributions
-	 *				then comparing the fits via rSquared
-	 */
-	//==============================================================================================
-	Parametric* norm = new Normal(Translation::fit<Normal>(fooExample));
-	Parametric* logExample = new Lognormal(Translation::fit<Lognormal>(fooExample));
-	double lnormFit = Translation::rSquared(logExample, fooExample); 
-	double normFit = Translation::rSquared(norm, fooExample); 
-	std::cout << lnormFit << std::endl;
-	std::cout << normFit << std::endl;
-
-	// TEST #10
-	/**	@brief		Create and call a function that takes a RandomVariable 
-	 *				and prints its parameters
-	 */
-	//==============================================================================================
-	RandomVariable* rv = new Normal(0,1);
-	printParams(rv);
-
-	// TEST #11
-	/**	@brief		Testing a function that creates a NonParametric object instantiated by 
-	 *				sampling a Parametric distribution
-	 */
-	//==============================================================================================
-	Parametric* p = new Normal(0,1);
-	NonParametric* uw = sampleDistParams(p);
-	uw->printData();
-
-	// TEST #12
-	/**	@brief		Testing sampling a RandomVariableContainer object	
-	 *	@details	Instantiate a normal, lognormal, and unweighted distribution then create a 
-	 *				RandomVariable pointer vector and pass to the RandomVariableContainer and sample
-	 */
-	//==============================================================================================
-	NonParametric* uws = new Unweighted();
-	NonParametric* luws = new Unweighted();
-	for (unsigned int i = 0; i < 100; i++) {
-		uws->append(i);
-		luws->append(i*2);
-	}
-
-	RandomVariable* g = new Normal(0, 1);
-	RandomVariable* l = new Lognormal(Translation::fit<Lognormal>(luws));
-
-	std::vector<RandomVariable*> rvs;
-	rvs.push_back(g);
-	rvs.push_back(l);
-	rvs.push_back(uws);
-	
-	RandomVariableContainer* rvc = new RandomVariableContainer(cal, rvs);
-	Weighted w = Translation::sampleMC<Weighted>(rvc, 100);
-	w.graph(2);
-#endif
-	return 0;
+		stream.push_back(std::sin(i * 0.7) * 100 + (i % 7));
+		win.append(stream.back());
+	}
+	const Unweighted last(RandomVariable::vector_type(stream.end() - capacity, stream.end()));
+	std::vector<double> sorted = last.getData();
+	std::sort(sorted.begin(), sorted.end());
+
+	CHECK(win.isFull() && win.getSize() == capacity);
+	CHECK(near(win.get(0), stream[stream.size() - capacity], 0));
+	CHECK(near(win.mean(), last.mean(), 1e-9));
+	CHECK(near(win.std(), last.std(), 1e-9));
+	CHECK(near(win.median(), (sorted[capacity / 2 - 1] + sorted[capacity / 2]) / 2, 0));
+	CHECK(near(win.min(), sorted.front(), 0) && near(win.max(), sorted.back(), 0));
+	CHECK(near(win.sampleSingleIcdf(1), sorted.back(), 0));
+
+	const Windowed small(3, { 1, 2, 3, 4 });
+	CHECK(near(small.median(), 3, 0) && near(small.mean(), 3, 1e-15));
+
+	// A NaN reading is rejected without touching the window, so later order statistics stay exact
+	Windowed telemetry(3);
+	unsigned int rejected = 0;
+	for (const double x : { 5.0, 9.0, std::nan(""), 7.0, 1.0, 2.0, 3.0 }) {
+		try {
+			telemetry.append(x);
+		} catch (const std::invalid_argument&) {
+			rejected++;
+		}
+	}
+	CHECK(rejected == 1 && telemetry.getSize() == 3 && near(telemetry.mean(), 2, 1e-15));
+	CHECK(near(telemetry.median(), 2, 0) && near(telemetry.min(), 1, 0) && near(telemetry.max(), 3, 0));
+}
+
+/**	@brief		Decaying statistics follow a stationary stream and reduce to Unweighted without decay */
+void testDecaying() {
+	std::mt19937 gen(7);
+	std::normal_distribution<double> normal(5, 2);
+	Decaying d(500);
+	for (unsigned int i = 0; i < 20000; i++) {
+		d.append(normal(gen));
+	}
+	CHECK(near(d.getWeight(), 1 / (1 - std::pow(0.5, 1 / 500.0)), 1e-6));
+	CHECK(near(d.mean(), 5, 0.3) && near(d.std(), 2, 0.3) && near(d.median(), 5, 0.3));
+	CHECK(near(d.sampleSingleIcdf(0.95), 5 + 2 * 1.645, 0.5));
+	CHECK(near(Translation::fit<Normal>(&d).mean(), d.mean(), 0));
+
+	const Decaying flat(1e300, { 0.5 }, { 1, 2, 3, 4 });
+	const Unweighted uw({ 1, 2, 3, 4 });
+	CHECK(near(flat.mean(), uw.mean(), 1e-12) && near(flat.std(), uw.std(), 1e-12));
+
+	// A half-life so short that earlier weights underflow leaves only the last value, not a NaN spread
+	Decaying instant(0.01);
+	for (unsigned int i = 1; i <= 10; i++) {
+		instant.append(i);
+	}
+	CHECK(near(instant.mean(), 10, 0) && near(instant.std(), 0, 0) && near(instant.median(), 10, 0));
+	const Decaying two(500, { 0.5 }, { 1, 3 });
+	CHECK(!std::isnan(two.median()) && two.std() > 0);
+}
+
+/**	@brief		Reservoirs keep a bounded uniform subsample, merge across threads and honour weights */
+void testReservoir() {
+	const unsigned int n = 100000;
+	const std::size_t capacity = 1000;
+	Reservoir single(capacity, 1);
+	for (unsigned int i = 0; i < n; i++) {
+		single.append(i);
+	}
+	CHECK(single.getSize() == capacity && single.getCount() == n);
+	CHECK(near(single.mean(), (n - 1) / 2.0, 4000));
+	CHECK_NO_ALLOC(single.append(1));
+
+	std::vector<Reservoir> parts(2, Reservoir(capacity, 0));
+	Parallel::run(2, [&](const unsigned int t) {
+		parts[t] = Reservoir(capacity, t + 2);
+		for (unsigned int i = 0; i < n; i++) {
+			parts[t].append(t * n + i);
+		}
+	});
+	parts[0].merge(parts[1]);
+	const RandomVariable::vector_type merged = parts[0].getData();
+	const long upper = std::count_if(merged.cbegin(), merged.cend(), [&](const double x){ return x >= n; });
+	CHECK(parts[0].getSize() == capacity && parts[0].getCount() == 2 * n);
+	CHECK(near(static_cast<double>(upper), capacity / 2.0, 100));
+
+	unsigned int heavy = 0;
+	for (unsigned int seed = 0; seed < 200; seed++) {
+		Reservoir r(1, seed);
+		r.append(std::make_pair(0.0, 1u));
+		r.append(std::make_pair(1.0, 99u));
+		heavy += r.get(0) > 0.5 ? 1u : 0u;
+	}
+	CHECK(heavy >= 185);
+
+	// Inclusion frequency is proportional to weight while the reservoir is a small fraction of the stream
+	double kept[4] = { 0, 0, 0, 0 };
+	for (unsigned int seed = 0; seed < 200; seed++) {
+		Reservoir r(20, seed);
+		for (unsigned int i = 0; i < 4000; i++) {
+			r.append(i % 4, 1 + i % 4);
+		}
+		for (const double x : r.getData()) {
+			kept[static_cast<std::size_t>(x)]++;
+		}
+	}
+	bool proportional = true;
+	for (std::size_t w = 0; w < 4; w++) {
+		proportional = proportional && near(kept[w] / (200 * 20), (w + 1) / 10.0, 0.02);
+	}
+	CHECK(proportional);
+
+	bool thrown = false;
+	try {
+		single.merge(single);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	CHECK(thrown && single.getSize() == capacity && single.getCount() == n + 2);
+}
+
+namespace {
+	/** @brief	Unweighted set whose next bulk append throws, as an allocation failure would */
+	class FailingUnweighted: public Unweighted {
+	public:
+		FailingUnweighted() : Unweighted(RandomVariable::vector_type{}), failNext(false) {}
+
+		using Unweighted::append;
+
+		void append(const size_type n, const double* values) {
+			if (failNext) {
+				failNext = false;
+				throw std::bad_alloc();
+			}
+			Unweighted::append(n, values);
+		}
+
+		bool failNext;
+	};
+}
+
+/**	@brief		Values appended from many threads all reach the data set after a flush */
+void testIngest() {
+	const unsigned int nThreads = 4;
+	const unsigned int n = 100000;
+	Unweighted uw(RandomVariable::vector_type{});
+	Ingest ingest(uw);
+	Parallel::run(nThreads, [&](const unsigned int t) {
+		Ingest::Producer p = ingest.producer();
+		for (unsigned int i = 0; i < n; i++) {
+			p.append(t);
+		}
+	});
+	CHECK(ingest.flush() == nThreads * n && uw.getSize() == nThreads * n);
+	CHECK(near(uw.mean(), (nThreads - 1) / 2.0, 1e-12));
+
+	Ingest::Producer p = ingest.producer();
+	CHECK_NO_ALLOC(p.append(1));
+	CHECK(ingest.flush() == 0);
+	p.flush();
+	CHECK(ingest.flush() == 2);
+
+	// A destroyed producer publishes its partial block without allocating a replacement
+	std::size_t before = 0;
+	{
+		Ingest::Producer q = ingest.producer();
+		q.append(1);
+		q.append(2);
+		before = Allocations::count();
+	}
+	CHECK(Allocations::count() == before && ingest.flush() == 2);
+
+	Ingest::Producer moved = std::move(p);
+	p.flush();
+	moved.append(3);
+	moved.flush();
+	CHECK(ingest.flush() == 1 && near(uw.get(uw.getSize() - 1), 3, 0));
+
+	// A flush that fails keeps every undrained block for the next one, in publication order
+	FailingUnweighted failing;
+	Ingest retry(failing);
+	for (const double x : { 1.0, 2.0, 3.0 }) {
+		Ingest::Producer r = retry.producer();
+		r.append(x);
+	}
+	failing.failNext = true;
+	bool thrown = false;
+	try {
+		retry.flush();
+	} catch (const std::bad_alloc&) {
+		thrown = true;
+	}
+	CHECK(thrown && failing.getSize() == 0);
+	CHECK(retry.flush() == 3 && failing.getData() == RandomVariable::vector_type({ 1, 2, 3 }));
+}
+
+/**	@brief		Readers see only published, internally consistent versions while a writer appends */
+void testVersioned() {
+	const unsigned int batches = 200;
+	const unsigned int batchSize = 50;
+	Versioned<Unweighted> live{Unweighted(RandomVariable::vector_type{})};
+	std::atomic<bool> done(false);
+	std::atomic<unsigned int> inconsistent(0);
+	Parallel::run(3, [&](const unsigned int t) {
+		if (t == 0) {
+			for (unsigned int b = 0; b < batches; b++) {
+				for (unsigned int i = 0; i < batchSize; i++) {
+					live.append(b);
+				}
+				live.publish();
+			}
+			done = true;
+			return;
+		}
+		std::size_t last = 0;
+		while (!done) {
+			const Versioned<Unweighted>::snapshot_type s = live.snapshot();
+			const std::size_t n = s->getSize();
+			// Every batch appends batchSize copies of its index, so the mean is fixed by the size
+			const double expected = n > 0 ? (static_cast<double>(n / batchSize) - 1) / 2 : 0;
+			if (n % batchSize != 0 || n < last || (n > 0 && !near(s->mean(), expected, 1e-9))) {
+				inconsistent++;
+			}
+			last = n;
+		}
+	});
+	CHECK(inconsistent == 0);
+	CHECK(live.getVersion() == batches && live.snapshot()->getSize() == batches * batchSize);
+
+	const Versioned<Unweighted>::snapshot_type old = live.snapshot();
+	live.update([](Unweighted& u){ u.set(0, 1000); });
+	CHECK(near(old->get(0), 0, 0) && near(live.snapshot()->get(0), 1000, 0));
+
+	// A throwing update publishes nothing and keeps the buffered values for the next publish
+	live.append(-1);
+	live.append(-2);
+	const std::size_t version = live.getVersion();
+	bool thrown = false;
+	try {
+		live.update([](Unweighted&){ throw std::runtime_error("update failed"); });
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	CHECK(thrown && live.getVersion() == version && live.snapshot()->getSize() == batches * batchSize);
+	CHECK(live.publish() == version + 1 && live.snapshot()->getSize() == batches * batchSize + 2);
+	CHECK(near(live.snapshot()->get(batches * batchSize + 1), -2, 0));
+}
+
+/**	@brief		Binning policies bound the number of Weighted pairs of continuous data */
+void testBinning() {
+	std::mt19937 gen(11);
+	std::normal_distribution<double> normal(5, 1);
+	RandomVariable::vector_type v(100000);
+	for (double& x : v) {
+		x = normal(gen);
+	}
+	const Unweighted raw(v);
+	const Weighted exact(v);
+	const Weighted absolute(v, Binning::absolute(0.01));
+	const Weighted relative(v, Binning::relative(1e-3));
+	const Weighted logarithmic(v, Binning::logarithmic(200));
+	CHECK(exact.getNumPairs() == v.size());
+	CHECK(absolute.getNumPairs() < 1500 && absolute.getSize() == v.size());
+	CHECK(relative.getNumPairs() < 10000 && logarithmic.getNumPairs() < 500);
+	CHECK(near(absolute.mean(), raw.mean(), 1e-3) && near(relative.mean(), raw.mean(), 1e-2));
+
+	CHECK(near(Binning::absolute(0.5).bin(1.3), 1.5, 1e-15) && near(Binning::logarithmic(1).bin(-20), -10, 1e-12));
+	CHECK(near(Binning::relative(0.25).bin(7), 8, 0) && near(Binning::ulps(4).bin(1 + 1e-16), 1, 0));
+
+	Weighted w(RandomVariable::vector_type{ 1.01, 1.02, 2 }, Binning::absolute(0.1));
+	w.append(0.98);
+	CHECK(w.getNumPairs() == 2 && w.getFreq(1) == 3);
+	w.rebin(Binning::absolute(10));
+	CHECK(w.getNumPairs() == 1 && w.getFreq(0) == 4);
+
+	// The median counts ranks by frequency, not by pair
+	CHECK(near(exact.median(), raw.median(), 0) && near(absolute.median(), raw.median(), 0.01));
+	CHECK(near(Weighted(RandomVariable::vector_type{ 1, 1, 1, 1, 5 }).median(), 1, 0));
+	CHECK(near(Weighted(RandomVariable::vector_type{ 1, 1, 2, 2, 2, 9 }).median(), 2, 0));
+	CHECK(near(Weighted(RandomVariable::vector_type{ 3, 1, 3, 1, 3, 1 }).median(), 2, 0));
+	CHECK(near(Weighted(RandomVariable::vector_type{ 7 }).median(), 7, 0));
+	Weighted heavy(RandomVariable::vector_type{ 2, 4 }, Binning::absolute(1));
+	for (unsigned int i = 0; i < 10; i++) {
+		heavy.append(1.2);
+	}
+	CHECK(heavy.getNumPairs() == 3 && near(heavy.median(), 1, 0));
+
+	// Appended values that are new to the set are inserted in order
+	Weighted appended(RandomVariable::vector_type{ 5, 1, 3 });
+	appended.append(4);
+	appended.append(std::make_pair(0.5, 2u));
+	appended.append(9);
+	appended.append(3);
+	CHECK(appended.getData() == RandomVariable::vector_type({ 0.5, 0.5, 1, 3, 3, 4, 5, 9 }));
+	CHECK(near(appended.median(), 3, 0) && near(appended.get(5), 4, 0));
+	// Values within isDoubleEqual() of a pair, on either side of it, join that pair
+	appended.append(std::nextafter(1.0, 0.0));
+	appended.append(std::nextafter(1.0, 2.0));
+	CHECK(appended.getNumPairs() == 6 && appended.getFreq(1) == 3 && appended.getSize() == 10);
+
+	// Pairs given in any order are sorted and merged, and pairs of frequency 0 are dropped
+	Weighted unsorted(RandomVariable::pvector_type{ std::make_pair(3.0, 1u), std::make_pair(1.0, 1u), std::make_pair(2.0, 1u),
+		std::make_pair(1.0, 2u), std::make_pair(8.0, 0u) });
+	CHECK(unsorted.getNumPairs() == 3 && unsorted.getSize() == 5 && near(unsorted.getPair(0).first, 1, 0) && unsorted.getFreq(1) == 3);
+	CHECK(near(unsorted.median(), 1, 0) && near(unsorted.get(0), 1, 0) && near(unsorted.get(4), 3, 0));
+	unsorted.set(0, std::make_pair(9.0, 2u));
+	CHECK(unsorted.getData() == RandomVariable::vector_type({ 2, 3, 9, 9 }) && near(unsorted.median(), 6, 0));
+	unsorted.set(2, std::make_pair(3.0, 1u));
+	CHECK(unsorted.getNumPairs() == 2 && unsorted.getData() == RandomVariable::vector_type({ 2, 3, 3 }));
+
+	Versioned<Weighted> live(Weighted(RandomVariable::vector_type{ 0 }));
+	live.append(5);
+	live.append(5);
+	live.publish();
+	CHECK(near(live.snapshot()->median(), 5, 0));
+}
+
+/**	@brief		Compressed sets decode exactly, answer rank queries and shrink binned data */
+void testCompressed() {
+	std::mt19937 gen(13);
+	std::normal_distribution<double> normal(5, 1);
+	RandomVariable::vector_type v(100000);
+	for (double& x : v) {
+		x = normal(gen);
+	}
+	const Weighted binned(v, Binning::absolute(0.001));
+	const Compressed grid(binned);
+	CHECK(grid.isGrid() && grid.getNumPairs() == binned.getNumPairs());
+	CHECK(grid.getWData() == binned.getWData());
+	CHECK(grid.getBytes() * 4 < 16 * binned.getNumPairs());
+	CHECK(near(grid.mean(), binned.mean(), 1e-12) && near(grid.std(), binned.std(), 1e-12));
+
+	const Weighted exact(v);
+	const Compressed raw(exact);
+	RandomVariable::vector_type sorted(v);
+	std::sort(sorted.begin(), sorted.end());
+	CHECK(!raw.isGrid() && raw.getData() == sorted);
+	CHECK(near(raw.get(12345), sorted[12345], 0) && near(raw.median(), (sorted[49999] + sorted[50000]) / 2, 0));
+	CHECK(raw.countAtMost(sorted[777]) == 778);
+
+	Compressed small(RandomVariable::pvector_type{ std::make_pair(3.0, 2u), std::make_pair(1.0, 1u) });
+	for (unsigned int i = 0; i < 300; i++) {
+		small.append(2 + i / 1000.0);
+	}
+	small.append(3);
+	CHECK(small.getSize() == 304 && small.getNumPairs() == 302);
+	CHECK(near(small.get(0), 1, 0) && near(small.get(1), 2, 0) && near(small.get(303), 3, 0) && small.countAtMost(2.5) == 301);
+
+	// Appends into a large set re-encode one block and keep the byte count in step with a fresh encoding
+	Compressed growing(binned);
+	Weighted reference(binned);
+	for (unsigned int i = 0; i < 5000; i++) {
+		const double x = normal(gen);
+		growing.append(x);
+		reference.append(x);
+	}
+	CHECK(growing.getWData() == reference.getWData() && growing.getSize() == reference.getSize());
+	CHECK(near(growing.median(), reference.median(), 0) && growing.countAtMost(5) == Compressed(reference).countAtMost(5));
+	CHECK(growing.getBytes() < 2 * Compressed(reference).getBytes());
+
+	Compressed empty{RandomVariable::pvector_type()};
+	bool thrown = false;
+	try {
+		empty.median();
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	empty.append(4);
+	CHECK(thrown && near(empty.median(), 4, 0));
+}
+
+/**	@brief		Views scan Unweighted and Weighted data without copying it */
+void testViews() {
+	const Unweighted uw({ 4, 1, 3 });
+	Weighted w(RandomVariable::pvector_type{ std::make_pair(1.0, 2u), std::make_pair(2.0, 1u), std::make_pair(5.0, 3u) });
+	// A frequency set to 0 keeps its pair, which the value view skips
+	w.setFreq(2, 0);
+	const Range<Weighted::const_value_iterator> values = w.values();
+	CHECK(uw.values().size() == 3 && near(*uw.values().begin(), 4, 0));
+	CHECK(values.size() == 5 && RandomVariable::vector_type(values.begin(), values.end()) == w.getData());
+	CHECK(w.pairs().size() == 3 && near(w.pairs().begin()->first, 1, 0));
+
+	double s = 0;
+	double t = 0;
+	CHECK_NO_ALLOC(s = std::accumulate(uw.values().begin(), uw.values().end(), 0.0));
+	CHECK_NO_ALLOC(t = std::accumulate(values.begin(), values.end(), 0.0));
+	CHECK(near(s, 8, 0) && near(t, 17, 0));
+	CHECK(Weighted(RandomVariable::pvector_type{ std::make_pair(1.0, 0u) }).values().empty());
+}
+
+/**	@brief		The parallel radix sort and the parallel Weighted construction match the serial results */
+void testSort() {
+	std::mt19937 gen(17);
+	std::normal_distribution<double> normal(0, 100);
+	RandomVariable::vector_type v(3 * Sort::MIN_CHUNK);
+	for (std::size_t i = 0; i < v.size(); i++) {
+		// Rounded values repeat, and every tenth value is exactly +-0
+		v[i] = i % 10 == 0 ? (i % 20 == 0 ? 0.0 : -0.0) : std::round(normal(gen) * 10) / 10;
+	}
+	RandomVariable::vector_type sorted(v);
+	std::sort(sorted.begin(), sorted.end());
+	RandomVariable::vector_type radix(v);
+	Sort::sort(radix.data(), radix.size(), 3);
+	CHECK(radix == sorted);
+
+	RandomVariable::pvector_type expected;
+	for (const double x : sorted) {
+		if (!expected.empty() && isDoubleEqual(expected.back().first, x)) {
+			expected.back().second++;
+		} else {
+			expected.push_back(std::make_pair(x, 1));
+		}
+	}
+	const Weighted w(v);
+	CHECK(w.getSize() == v.size() && w.getWData().size() == expected.size());
+	bool same = true;
+	for (std::size_t i = 0; i < expected.size(); i++) {
+		same = same && isDoubleEqual(w.getPair(i).first, expected[i].first) && w.getPair(i).second == expected[i].second;
+	}
+	CHECK(same);
+}
+
+/**	@brief		Bulk transform and gather on Unweighted match element-wise get/set */
+void testTransformGather() {
+	Unweighted uw({ 1, 2, 3, 4 });
+	uw.transform([](const double x){ return 2 * x + 1; });
+	CHECK(uw.getData() == RandomVariable::vector_type({ 3, 5, 7, 9 }));
+	const std::vector<std::size_t> indices{ 3, 0, 3 };
+	CHECK(uw.gather(indices) == RandomVariable::vector_type({ 9, 3, 9 }));
+	double out[3];
+	CHECK_NO_ALLOC(uw.gather(3, indices.data(), out));
+	bool thrown = false;
+	try {
+		uw.gather(std::vector<std::size_t>{ 4 });
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	CHECK(thrown);
+
+	UnweightedF large(UnweightedF::storage_type(4 * UnweightedF::MIN_CHUNK, 1.5f));
+	large.transform([](const float x){ return x * x; }, 4);
+	CHECK(near(large.mean(), 2.25, 0));
+}
+
+/**	@brief		Unweighted median matches a sorted copy, with and without incremental tracking */
+void testMedian() {
+	Unweighted odd({ 5, 1, 4, 2, 3 });
+	Unweighted even({ 4, 1, 3, 2 });
+	CHECK(near(odd.median(), 3, 0) && near(even.median(), 2.5, 0));
+	// Selection works on a copy, so the data keeps its order
+	CHECK(near(odd.get(0), 5, 0) && near(odd.get(2), 4, 0) && near(odd.get(4), 3, 0));
+
+	std::mt19937 gen(7);
+	std::uniform_real_distribution<double> dist(-10, 10);
+	RandomVariable::vector_type values(1001);
+	for (double& v : values) {
+		v = dist(gen);
+	}
+	Unweighted tracked(values);
+	Unweighted plain(values);
+	tracked.setMedianTracking(true);
+	CHECK(tracked.isMedianTracked() && !plain.isMedianTracked());
+	const auto sortedMedian = [](RandomVariable::vector_type v) {
+		std::sort(v.begin(), v.end());
+		const std::size_t m = v.size() / 2;
+		return v.size() % 2 == 0 ? (v[m - 1] + v[m]) / 2 : v[m];
+	};
+	bool same = true;
+	for (unsigned int i = 0; i < 200; i++) {
+		const double x = dist(gen);
+		if (i % 3 == 0) {
+			const std::size_t k = (i * 37u) % values.size();
+			values[k] = x;
+			tracked.set(k, x);
+			plain.set(k, x);
+		} else {
+			values.push_back(x);
+			tracked.append(x);
+			plain.append(x);
+		}
+		const double expected = sortedMedian(values);
+		same = same && near(tracked.median(), expected, 0) && near(plain.median(), expected, 0);
+	}
+	CHECK(same);
+
+	const double block[] = { 50, 60, 70 };
+	values.insert(values.end(), block, block + 3);
+	tracked.append(3, block);
+	CHECK(near(tracked.median(), sortedMedian(values), 0));
+	tracked.transform([](const double x){ return -x; });
+	CHECK(near(tracked.median(), -sortedMedian(values), 0));
+	tracked.setMedianTracking(false);
+	CHECK(!tracked.isMedianTracked() && near(tracked.median(), -sortedMedian(values), 0));
+}
+
+/**	@brief		Maximum likelihood fits from sufficient statistics match the closed forms on the data */
+void testFitMLE() {
+	const RandomVariable::vector_type values{ 1e9 + 1, 1e9 + 2, 1e9 + 4, 1e9 + 4, 1e9 + 9 };
+	const Unweighted uw(values);
+	const Weighted w(values);
+	const SufficientStats su(uw);
+	const SufficientStats sw(w);
+	CHECK(near(su.getCount(), 5, 0) && near(sw.getCount(), 5, 0));
+	CHECK(near(su.mean(), 1e9 + 4, 1e-6) && near(su.variance(), 7.6, 1e-9) && near(sw.variance(), 7.6, 1e-9));
+	CHECK(near(su.sum(), 5e9 + 20, 1e-3) && near(su.sumLog(), sw.sumLog(), 1e-9));
+
+	// Incremental adds and merges with a different shift give the statistics of the whole data set
+	SufficientStats incremental;
+	SufficientStats tail;
+	for (std::size_t i = 0; i < values.size(); i++) {
+		(i < 2 ? incremental : tail).add(values[i]);
+	}
+	incremental.merge(tail);
+	CHECK(near(incremental.mean(), su.mean(), 1e-6) && near(incremental.variance(), 7.6, 1e-9));
+	CHECK(near(incremental.logVariance(), su.logVariance(), 1e-15));
+
+	const Normal normal = Translation::fitMLE<Normal>(&uw);
+	CHECK(near(normal.getMu(), 1e9 + 4, 1e-6) && near(normal.getSigma(), std::sqrt(7.6), 1e-9));
+
+	const Lognormal source(1, 0.5);
+	const Unweighted logs(source.sample(100000));
+	const Lognormal lognormal = Translation::fitMLE<Lognormal>(&logs);
+	CHECK(near(lognormal.getMu(), 1, 0.01) && near(lognormal.getSigma(), 0.5, 0.01));
+	SufficientStats running(logs);
+	running.add(std::exp(1.0), 3);
+	const Unweighted extended([&]{ RandomVariable::vector_type v = logs.getData(); v.insert(v.end(), 3, std::exp(1.0)); return v; }());
+	CHECK(near(Translation::fitMLE<Lognormal>(running).getSigma(), Translation::fitMLE<Lognormal>(&extended).getSigma(), 1e-12));
+
+	bool thrown = false;
+	try {
+		const Unweighted negative({ -1, 2, 3 });
+		Translation::fitMLE<Lognormal>(&negative);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	CHECK(thrown);
+}
+
+/**	@brief		Goodness of fit statistics match their definitions and rank the generating family first */
+void testCompare() {
+	const Normal standard(0, 1);
+	const Unweighted small({ 0.3, -1.2, 0.8, 2.1, -0.4 });
+	RandomVariable::vector_type x = small.getData();
+	std::sort(x.begin(), x.end());
+	const double n = static_cast<double>(x.size());
+	double ks = 0, ad = 0, ll = 0, sse = 0, sst = 0;
+	for (std::size_t i = 0; i < x.size(); i++) {
+		const double f = standard.cdf(x[i]);
+		const double e = (static_cast<double>(i) + 0.5) / n;
+		ks = std::max(ks, std::max(f - static_cast<double>(i) / n, static_cast<double>(i + 1) / n - f));
+		ad += (2 * static_cast<double>(i) + 1) * (std::log(f) + std::log(1 - standard.cdf(x[x.size() - 1 - i])));
+		ll += std::log(standard.pdf(x[i]));
+		sse += (f - e) * (f - e);
+		sst += (e - 0.5) * (e - 0.5);
+	}
+	const Translation::GoodnessOfFit g = Translation::compare(&small, { &standard }).front();
+	CHECK(g.candidate == 0 && near(g.ks, ks, 1e-15) && near(g.andersonDarling, -n - ad / n, 1e-12));
+	CHECK(near(g.logLikelihood, ll, 1e-12) && near(g.aic, 4 - 2 * ll, 1e-12) && near(g.bic, 2 * std::log(n) - 2 * ll, 1e-12));
+	CHECK(near(g.rSquared, 1 - sse / sst, 1e-12) && near(Translation::rSquared(&small, &standard), g.rSquared, 0));
+
+	// The family that generated the data ranks first, whatever the number of threads
+	const Unweighted normalData(Normal(10, 1).sample(50000));
+	const Unweighted lognormalData(Lognormal(0, 0.8).sample(50000));
+	for (const Unweighted* data : { &normalData, &lognormalData }) {
+		const Normal fn = Translation::fitMLE<Normal>(data);
+		const Lognormal fl = Translation::fitMLE<Lognormal>(data);
+		const std::vector<Translation::GoodnessOfFit> serial = Translation::compare(data, { &fn, &fl }, 1);
+		const std::vector<Translation::GoodnessOfFit> parallel = Translation::compare(data, { &fn, &fl }, 8);
+		CHECK(serial[0].candidate == (data == &normalData ? 0u : 1u) && serial[0].ks < serial[1].ks);
+		CHECK(serial[0].candidate == parallel[0].candidate && near(serial[0].aic, parallel[0].aic, 1e-6 * std::fabs(serial[0].aic)));
+		CHECK(serial[0].rSquared > 0.999);
+	}
+
+	bool thrown = false;
+	try {
+		Translation::compare(&small, { nullptr });
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	CHECK(thrown);
+
+	// R squared of a single value is undefined: NaN in compare(), an error from rSquared()
+	const Unweighted one(RandomVariable::vector_type{ 0.5 });
+	const Translation::GoodnessOfFit single = Translation::compare(&one, { &standard }).front();
+	CHECK(std::isnan(single.rSquared) && near(single.ks, 0.5 + std::fabs(standard.cdf(0.5) - 0.5), 1e-15));
+	thrown = false;
+	try {
+		Translation::rSquared(&one, &standard);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	CHECK(thrown);
+}
+
+/**	@brief		Buffer-based sampling does not allocate */
+void testSamplingAllocations() {
+	const unsigned int n = 1000;
+	std::vector<double> out(n);
+	std::vector<float> outF(n);
+	const Normal normal(0, 1);
+	const Lognormal lognormal(0, 1);
+	const Unweighted uw({ 1, 2, 3, 4 });
+	const UnweightedF uwF(UnweightedF::storage_type{ 1, 2, 3, 4 });
+	const Weighted w(RandomVariable::vector_type{ 1, 2, 2, 3 });
+	const Distribution d(normal);
+
+	CHECK_NO_ALLOC(normal.sample(n, out.data()));
+	CHECK_NO_ALLOC(normal.sample(n, outF.data()));
+	CHECK_NO_ALLOC(lognormal.sample(n, out.data()));
+	CHECK_NO_ALLOC(lognormal.sample(n, outF.data()));
+	CHECK_NO_ALLOC(uw.sample(n, out.data()));
+	CHECK_NO_ALLOC(uwF.sample(n, outF.data()));
+	CHECK_NO_ALLOC(w.sample(n, out.data()));
+	CHECK_NO_ALLOC(w.sample(n, outF.data()));
+	CHECK_NO_ALLOC(d.sample(n, out.data()));
+}
+
+/**	@brief		Batch icdf/cdf over buffers does not allocate */
+void testBatchAllocations() {
+	const unsigned int n = 1000;
+	std::vector<double> y(n);
+	std::vector<float> yF(n);
+	for (unsigned int i = 0; i < n; i++) {
+		y[i] = (i + 0.5) / n;
+		yF[i] = static_cast<float>(y[i]);
+	}
+	std::vector<double> out(n);
+	std::vector<float> outF(n);
+	const Normal normal(0, 1);
+	const Lognormal lognormal(0, 1);
+	const Distribution d(lognormal);
+	const NormalBatch batch(n, 0, 1);
+
+	CHECK_NO_ALLOC(normal.sampleIcdf(n, y.data(), out.data()));
+	CHECK_NO_ALLOC(normal.sampleIcdf(n, yF.data(), outF.data()));
+	CHECK_NO_ALLOC(lognormal.sampleIcdf(n, y.data(), out.data()));
+	CHECK_NO_ALLOC(d.icdf(n, y.data(), out.data()));
+	CHECK_NO_ALLOC(batch.icdf(y.data(), out.data(), 1));
+	CHECK_NO_ALLOC(batch.cdf(0.5, out.data(), 1));
+	CHECK_NO_ALLOC(batch.sample(out.data(), 7, 1));
+}
+
+/**	@brief		Statistics and appends of existing values do not allocate */
+void testStatisticsAllocations() {
+	Unweighted uw({ 1, 2, 3, 4, 5 });
+	// An untracked median selects over a copy of the data
+	uw.setMedianTracking(true);
+	Weighted w(RandomVariable::vector_type{ 1, 2, 3, 4, 5 });
+	volatile double sink = 0;
+
+	CHECK_NO_ALLOC(sink = uw.mean());
+	CHECK_NO_ALLOC(sink = uw.std());
+	CHECK_NO_ALLOC(sink = uw.median());
+	CHECK_NO_ALLOC(sink = w.mean());
+	CHECK_NO_ALLOC(sink = w.std());
+	CHECK_NO_ALLOC(sink = w.median());
+	CHECK_NO_ALLOC(sink = w.mode());
+	CHECK_NO_ALLOC(w.append(3.0));
+	CHECK_NO_ALLOC(w.append(std::make_pair(4.0, 2u)));
+	CHECK(w.getNumPairs() == 5);
+	static_cast<void>(sink);
+}
+
+/**	@brief		An arena reused after reset() serves allocations without the heap */
+void testArenaAllocations() {
+	Arena arena(1 << 16);
+	CHECK_NO_ALLOC({
+		arena.reset();
+		std::vector<double, ArenaAllocator<double> > v(1000, 0.0, ArenaAllocator<double>(arena));
+	});
+}
+
+/**	@brief		Instrumentation counts calls, samples and bytes per operation, and reset() zeroes them;
+ *				with RV_INSTRUMENTATION off every counter stays zero
+ */
+void testInstrumentation() {
+	using Instrumentation::Operation;
+	// Expected counts are scaled by on, so the checks also hold when recording is compiled out
+	const std::uint64_t on = Instrumentation::enabled ? 1 : 0;
+	const Normal normal(0, 1);
+	const Unweighted uw({ 4, 1, 3, 2 });
+	double buffer[50];
+
+	Instrumentation::reset();
+	const RandomVariable::vector_type samples = normal.sample(100);
+	normal.sample(50, buffer);
+	normal.sampleIcdf(3, RandomVariable::vector_type{ 0.1, 0.5, 0.9 });
+	uw.median();
+	uw.mean();
+	const Instrumentation::Snapshot s = Instrumentation::snapshot();
+	CHECK(s[Operation::SAMPLE].calls == 2 * on && s[Operation::SAMPLE].samples == 150 * on);
+	CHECK(s[Operation::SAMPLE].bytes == 100 * sizeof(double) * on);
+	CHECK(s[Operation::ICDF].calls == on && s[Operation::ICDF].samples == 3 * on && s[Operation::ICDF].bytes == 3 * sizeof(double) * on);
+	// The untracked median copies the data set; the mean does not allocate
+	CHECK(s[Operation::STATISTICS].calls == 2 * on && s[Operation::STATISTICS].samples == 0);
+	CHECK(s[Operation::STATISTICS].bytes == 4 * sizeof(double) * on);
+	CHECK(s[Operation::TRANSLATION_SAMPLE].calls == 0 && s[Operation::TRANSLATION_FIT].calls == 0);
+	CHECK(std::string(Instrumentation::name(Operation::TRANSLATION_FIT)) == "translation_fit");
+
+	Instrumentation::reset();
+	const Instrumentation::Snapshot cleared = Instrumentation::snapshot();
+	bool zero = true;
+	for (const Instrumentation::Counters& c : cleared.counters) {
+		zero = zero && c.calls == 0 && c.samples == 0 && c.bytes == 0 && c.nanoseconds == 0;
+	}
+	CHECK(zero);
+}
+
+/**	@brief		Spans are exported as Chrome complete events and recording one does not allocate */
+void testTrace() {
+	Trace::clear();
+	{
+		const Trace::Span span("test span");
+		if (Trace::enabled) {
+			Normal(0, 1).sampleSingle();
+		}
+	}
+	std::ostringstream os;
+	Trace::dump(os);
+	const std::string trace = os.str();
+	CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+	CHECK(trace.find("{\"name\": \"test span\", \"ph\": \"X\"") != std::string::npos);
+	CHECK(!Trace::enabled || trace.find("\"Normal::sample\"") != std::string::npos);
+	CHECK_NO_ALLOC(const Trace::Span span("allocation-free span"));
+	Trace::clear();
+
+	// User span names are escaped, so quotes, backslashes and control characters keep the JSON valid
+	{
+		const Trace::Span span("say \"hi\" C:\\tmp\tend");
+	}
+	std::ostringstream escaped;
+	Trace::dump(escaped);
+	CHECK(escaped.str().find("{\"name\": \"say \\\"hi\\\" C:\\\\tmp\\u0009end\", \"ph\"") != std::string::npos);
+	Trace::clear();
+}
+
+int main() {
+	try {
+		testParametric();
+		testNonParametric();
+		testLoader();
+		testDistribution();
+		testKernels();
+		testParametricBatch();
+		testWindowed();
+		testDecaying();
+		testReservoir();
+		testIngest();
+		testVersioned();
+		testBinning();
+		testCompressed();
+		testViews();
+		testSort();
+		testTransformGather();
+		testMedian();
+		testFitMLE();
+		testCompare();
+		testSamplingAllocations();
+		testBatchAllocations();
+		testStatisticsAllocations();
+		testArenaAllocations();
+		testInstrumentation();
+		testTrace();
+	} catch (const std::exception& e) {
+		std::cerr << "Unexpected exception: " << e.what() << std::endl;
+		return 1;
+	}
+	std::cout << checks - failures << "/" << checks << " checks passed" << std::endl;
+	return failures > 0 ? 1 : 0;
 }